@@ -20,6 +20,7 @@
 
 
 #include <vector>
+#include <utility>
 #include <cmath>
 #include <cstddef>
 #include <gmpxx.h>
@@ -36,6 +37,18 @@ public:
     return var_frequency_scores_[v];
   }
 
+  // true iff assigning v splits the component
+  // of the last call to recordArticulationPointsOf
+  bool isArticulationPoint(VariableIndex v) {
+    return articulation_points_[v];
+  }
+
+  // finds the articulation points of comp by Tarjan's lowpoint search,
+  // comp must be the component about to be branched on; components
+  // of fewer than min_size variables are not searched, none of their
+  // variables counts as articulation point then
+  void recordArticulationPointsOf(Component &comp, unsigned min_size);
+
   ComponentArchetype &current_archetype(){
     return archetype_;
   }
@@ -43,6 +56,13 @@ public:
   void initialize(LiteralIndexedVector<Literal> & literals,
       std::vector<LiteralID> &lit_pool);
 
+  // has to be called before initialize, with incremental analysis
+  // the score of a variable counts all of its active binary clauses,
+  // not only those the search went along
+  void set_incremental_analysis(bool enabled) {
+    incremental_analysis_ = enabled;
+  }
+
 
   bool isUnseenAndActive(VariableIndex v) {
     assert(v <= max_variable_id_);
@@ -85,6 +105,26 @@ public:
          archetype_.setClause_in_sup_comp_unseen(itCl->get<ClauseIndex>());
   }
 
+  // Analyses super_comp, the component branched on at top, from the
+  // literals [lits_begin, lits_end) assigned at top. super_comp was
+  // connected when it was found, so each of its remaining components
+  // contains a variable adjacent to one of these literals. Search trees
+  // are grown in turns from all such variables and merged when they
+  // meet, the search stops as soon as at most one tree is left growing:
+  // the rest of super_comp is the component of that tree then.
+  // The scores and the clauses with false literals are only updated
+  // where the literals touch super_comp, for which the state left by
+  // the analysis that found super_comp is saved with it.
+  // Returns false if incremental analysis is off.
+  bool setupIncrementalAnalysisContext(StackLevel &top, Component &super_comp,
+      std::vector<LiteralID>::const_iterator lits_begin,
+      std::vector<LiteralID>::const_iterator lits_end);
+
+  // the next non-trivial component found by the incremental analysis,
+  // nullptr once all are made, trivial components are included
+  // in the solution of the stack level on the way
+  Component *makeNextExploredComp();
+
   // returns true, iff the component found is non-trivial
   bool exploreRemainingCompOf(VariableIndex v) {
     assert(archetype_.var_unseen_in_sup_comp(v));
@@ -100,7 +140,15 @@ public:
 
 
   inline Component *makeComponentFromArcheType(){
-    return archetype_.makeComponentFromState(search_stack_.size());
+    Component *p_new_comp = archetype_.makeComponentFromState(search_stack_.size());
+    if (incremental_analysis_) {
+      for (auto it = p_new_comp->clsBegin(); it->get<ClauseIndex>() != clsSENTINEL; it++)
+        clause_has_false_lit_[static_cast<unsigned>(it->get<ClauseIndex>())] = false;
+      Component &cache_key = archetype_.current_comp_for_caching_;
+      for (auto it = cache_key.clsBegin(); it->get<ClauseIndex>() != clsSENTINEL; it++)
+        clause_has_false_lit_[static_cast<unsigned>(it->get<ClauseIndex>())] = true;
+    }
+    return p_new_comp;
   }
 
   ClauseIndex max_clause_id(){
@@ -115,7 +163,7 @@ public:
     return archetype_;
   }
 
-private:
+protected:
   // the id of the last clause
   // note that clause ID is the clause number,
   // different from the offset of the clause in the literal pool
@@ -145,6 +193,158 @@ private:
 
   std::vector<VariableIndex> search_stack_;
 
+  VariableIndexedVector<bool> articulation_points_;
+
+  // the depth first search for articulation points runs on the graph
+  // of variables and clauses (of more than two literals) of the component,
+  // a variable is adjacent to the variables it shares a binary clause with
+  // and to the clauses it occurs in; clause cl is node max_variable_id_ + cl
+  std::vector<unsigned> dfs_index_;
+  std::vector<unsigned> dfs_low_;
+  // nodes with an index above the counter at the start of the search
+  // have been visited by it
+  unsigned dfs_counter_ = 0;
+  // the nodes of the component searched are those marked with dfs_round_
+  std::vector<unsigned> dfs_member_;
+  unsigned dfs_round_ = 0;
+
+  typedef std::vector<Variant<ClauseIndex,LiteralID,VariableIndex,unsigned>>::iterator LinkIterator;
+
+  bool incremental_analysis_ = false;
+
+  // the literals of each clause (of more than two literals),
+  // clause cl starts at clause_literals_ofs_[cl] and ends with SENTINEL_LIT
+  std::vector<LiteralID> clause_literals_;
+  std::vector<unsigned> clause_literals_ofs_;
+
+  // whether a clause of the component it was last found in has
+  // a false literal, those clauses make up the cache key
+  std::vector<unsigned char> clause_has_false_lit_;
+
+  // a search tree of the incremental analysis, the trees are merged
+  // by union-find; the variables and clauses of a tree are kept in cyclic
+  // lists, the variables yet to expand in a list
+  struct SearchTree {
+    unsigned parent;
+    unsigned size;
+    VariableIndex first_var;
+    ClauseIndex first_clause;
+    VariableIndex pending_head;
+    VariableIndex pending_tail;
+  };
+  std::vector<SearchTree> trees_;
+  struct TreeLinks {
+    // the tree the variable was added to
+    unsigned tree;
+    VariableIndex next;
+    VariableIndex next_pending;
+  };
+  VariableIndexedVector<TreeLinks> tree_links_;
+  std::vector<ClauseIndex> next_clause_;
+  // the trees still growing, some of them may have been merged
+  std::vector<unsigned> growing_trees_;
+  unsigned num_growing_trees_ = 0;
+  // the trees found complete with their first variables (the trivial
+  // ones are dropped once the search has ended),
+  // the next one to make a component of, and whether the rest of the
+  // super component is left to make one of; the components are made
+  // in the order of their first variables, as by the full analysis
+  std::vector<std::pair<VariableIndex, unsigned>> complete_trees_;
+  unsigned next_complete_tree_ = 0;
+  bool rest_pending_ = false;
+  VariableIndex rest_first_var_;
+  std::vector<ClauseIndex> clauses_found_;
+
+  bool inSuperComp(VariableIndex v) {
+    return archetype_.var_unseen_in_sup_comp(v) || archetype_.var_seen(v);
+  }
+
+  unsigned findTree(unsigned t) {
+    while (trees_[t].parent != t)
+      t = trees_[t].parent = trees_[trees_[t].parent].parent;
+    return t;
+  }
+
+  unsigned newTree(VariableIndex v) {
+    unsigned t = trees_.size();
+    trees_.push_back(SearchTree{t, 1, v, ClauseIndex(0), v, v});
+    archetype_.setVar_seen(v);
+    tree_links_[v] = TreeLinks{t, v, VariableIndex(0)};
+    growing_trees_.push_back(t);
+    num_growing_trees_++;
+    return t;
+  }
+
+  void addVarToTree(unsigned t, VariableIndex v) {
+    SearchTree &tree = trees_[t];
+    archetype_.setVar_seen(v);
+    tree_links_[v] = TreeLinks{t, tree_links_[tree.first_var].next, VariableIndex(0)};
+    tree_links_[tree.first_var].next = v;
+    if (tree.pending_head == VariableIndex(0))
+      tree.pending_head = v;
+    else
+      tree_links_[tree.pending_tail].next_pending = v;
+    tree.pending_tail = v;
+    tree.size++;
+  }
+
+  void addClauseToTree(unsigned t, ClauseIndex cl) {
+    SearchTree &tree = trees_[t];
+    archetype_.setClause_seen(cl);
+    if (tree.first_clause == ClauseIndex(0)) {
+      next_clause_[static_cast<unsigned>(cl)] = cl;
+      tree.first_clause = cl;
+    } else {
+      next_clause_[static_cast<unsigned>(cl)] =
+          next_clause_[static_cast<unsigned>(tree.first_clause)];
+      next_clause_[static_cast<unsigned>(tree.first_clause)] = cl;
+    }
+  }
+
+  // merges the growing trees with roots s and t, returns the new root
+  unsigned mergeTrees(unsigned s, unsigned t);
+
+  // adds the variable of lit to tree t (no tree if t == ~0u),
+  // returns the tree it ends up in
+  unsigned manageTreeOccurrenceOf(unsigned t, LiteralID lit) {
+    VariableIndex v = lit.var();
+    if (archetype_.var_unseen_in_sup_comp(v)) {
+      if (t == ~0u)
+        return newTree(v);
+      addVarToTree(t, v);
+      return t;
+    }
+    if (archetype_.var_seen(v) && tree_links_[v].tree != t) {
+      unsigned s = tree_links_[v].tree = findTree(tree_links_[v].tree);
+      if (t == ~0u || s == t)
+        return s;
+      return mergeTrees(s, t);
+    }
+    return t;
+  }
+
+  // processes the clause cl of the super component containing
+  // the variable of a literal assigned at the analysed level
+  void manageTouchedClause(ClauseIndex cl);
+
+  // expands the next pending variable of the growing tree t
+  void expandTree(unsigned t);
+
+  // makes a component of the variables and clauses of the complete tree t
+  Component *makeComponentFromTree(unsigned t);
+
+  enum class DFSPhase : unsigned char {
+    BINARY_LINKS, TERNARY_CLAUSES, LONG_CLAUSES, CLAUSE_LITERALS
+  };
+  struct DFSFrame {
+    unsigned node;
+    LinkIterator pos;
+    DFSPhase phase;
+    // literals left to visit of a ternary clause node
+    unsigned remaining;
+  };
+  std::vector<DFSFrame> dfs_stack_;
+
   bool isResolved(const LiteralID lit) {
     return literal_values_[lit] == TriValue::F_TRI;
   }
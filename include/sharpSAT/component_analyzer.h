@@ -48,6 +48,30 @@ public:
     return var_frequency_scores_[v];
   }
 
+  // articulation points are only searched by the AltComponentAnalyzer
+  // and the UFComponentAnalyzer derived from it
+  bool isArticulationPoint(VariableIndex) {
+    return false;
+  }
+
+  void recordArticulationPointsOf(Component &, unsigned) {
+  }
+
+  // incremental analysis is only done by the AltComponentAnalyzer
+  // and the UFComponentAnalyzer derived from it
+  void set_incremental_analysis(bool) {
+  }
+
+  bool setupIncrementalAnalysisContext(StackLevel &, Component &,
+      std::vector<LiteralID>::const_iterator,
+      std::vector<LiteralID>::const_iterator) {
+    return false;
+  }
+
+  Component *makeNextExploredComp() {
+    return nullptr;
+  }
+
   ComponentArchetype &current_archetype(){
     return archetype_;
   }
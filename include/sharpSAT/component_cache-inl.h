@@ -10,7 +10,8 @@
 
 namespace sharpSAT {
 
-CacheEntryID ComponentCache::storeAsEntry(CacheableComponent &ccomp, CacheEntryID super_comp_id){
+template<class T_Cacheable>
+CacheEntryID GenericComponentCache<T_Cacheable>::storeAsEntry(T_Cacheable &ccomp, CacheEntryID super_comp_id){
     CacheEntryID id;
 
     if (statistics_.cache_full())
@@ -53,7 +54,8 @@ CacheEntryID ComponentCache::storeAsEntry(CacheableComponent &ccomp, CacheEntryI
     return id;
 }
 
-void ComponentCache::cleanPollutionsInvolving(CacheEntryID id) {
+template<class T_Cacheable>
+void GenericComponentCache<T_Cacheable>::cleanPollutionsInvolving(CacheEntryID id) {
   CacheEntryID father = entry(id).father();
   if (entry(father).first_descendant() == id) {
     entry(father).set_first_descendant(entry(id).next_sibling());
@@ -79,7 +81,8 @@ void ComponentCache::cleanPollutionsInvolving(CacheEntryID id) {
   eraseEntry(id);
 }
 
-void ComponentCache::removeFromHashTable(CacheEntryID id) {
+template<class T_Cacheable>
+void GenericComponentCache<T_Cacheable>::removeFromHashTable(CacheEntryID id) {
   //assert(false);
   unsigned act_id = table_[tableEntry(id)];
   if(act_id == id){
@@ -105,7 +108,8 @@ void ComponentCache::removeFromHashTable(CacheEntryID id) {
 //      }
 }
 
-void ComponentCache::removeFromDescendantsTree(CacheEntryID id) {
+template<class T_Cacheable>
+void GenericComponentCache<T_Cacheable>::removeFromDescendantsTree(CacheEntryID id) {
   assert(hasEntry(id));
   // we need a father for this all to work
   assert(entry(id).father());
@@ -139,7 +143,8 @@ void ComponentCache::removeFromDescendantsTree(CacheEntryID id) {
   }
 }
 
-void ComponentCache::storeValueOf(CacheEntryID id, const mpz_class &model_count) {
+template<class T_Cacheable>
+void GenericComponentCache<T_Cacheable>::storeValueOf(CacheEntryID id, const mpz_class &model_count) {
   considerCacheResize();
   unsigned table_ofs = tableEntry(id);
   // when storing the new model count the size of the model count
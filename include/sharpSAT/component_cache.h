@@ -9,6 +9,7 @@
 #define SHARP_SAT_COMPONENT_CACHE_H_
 
 
+#include <sharpSAT/containers.h>
 #include <sharpSAT/stack.h>
 #include <sharpSAT/statistics.h>
 #include <sharpSAT/solver_config.h>
@@ -20,12 +21,15 @@
 
 namespace sharpSAT {
 
-class ComponentCache {
+// the cache of model counts of components,
+// stored as packed copies of type T_Cacheable
+template<class T_Cacheable>
+class GenericComponentCache {
 public:
 
-  ComponentCache(DataAndStatistics &statistics);
+  GenericComponentCache(DataAndStatistics &statistics);
 
-  ~ComponentCache() {
+  ~GenericComponentCache() {
    // debug_dump_data();
     for (auto &pentry : entry_base_)
           if (pentry != nullptr)
@@ -38,13 +42,13 @@ public:
   // the value is stored in bytes_memory_usage_
   uint64_t compute_byte_size_infrasture();
 
-  CacheableComponent &entry(CacheEntryID id) {
+  T_Cacheable &entry(CacheEntryID id) {
     assert(entry_base_.size() > id);
     assert(entry_base_[id] != nullptr);
     return *entry_base_[id];
   }
 
-  CacheableComponent &entry(const Component& comp) {
+  T_Cacheable &entry(const Component& comp) {
       return entry(comp.id());
   }
 
@@ -66,20 +70,23 @@ public:
   // returns the id of the entry created
   // stores in the entry the position of
   // comp which is a part of the component stack
-  inline CacheEntryID storeAsEntry(CacheableComponent &ccomp,
+  inline CacheEntryID storeAsEntry(T_Cacheable &ccomp,
                             CacheEntryID super_comp_id);
 
   // check quickly if the model count of the component is cached
   // if so, incorporate it into the model count of top
   // if not, store the packed version of it in the entry_base of the cache
-  bool manageNewComponent(StackLevel &top, CacheableComponent &packed_comp) {
+  bool manageNewComponent(StackLevel &top, T_Cacheable &packed_comp) {
        statistics_.num_cache_look_ups_++;
+       statistics_.sum_cache_look_up_sizes_ += packed_comp.num_variables();
        unsigned table_ofs =  packed_comp.hashkey() & table_size_mask_;
 
        CacheEntryID act_id = table_[table_ofs];
        while(act_id){
          if (entry(act_id).equals(packed_comp)) {
            statistics_.incorporate_cache_hit(packed_comp);
+           creditCacheHit(entry(act_id).branch_variable(),
+                          packed_comp.num_variables());
            top.includeSolution(entry(act_id).model_count());
            return true;
          }
@@ -89,6 +96,14 @@ public:
   }
 
 
+  // the summed size of the cache hits on the components found in
+  // branches on v, relative to the largest such sum (in [0, 1])
+  float cacheHitScoreOf(VariableIndex v) {
+    if (max_branch_hit_size_ == 0)
+      return 0;
+    return branch_hit_sizes_[v] / (float) max_branch_hit_size_;
+  }
+
   // unchecked erase of an entry from entry_base_
   void eraseEntry(CacheEntryID id) {
     statistics_.incorporate_cache_erase(*entry_base_[id]);
@@ -142,6 +157,14 @@ private:
   unsigned tableEntry(CacheEntryID id){
     return entry(id).hashkey() & table_size_mask_;
   }
+  void creditCacheHit(VariableIndex branch_variable, unsigned hit_size) {
+    if (branch_variable == VariableIndex(0))
+      return;
+    branch_hit_sizes_[branch_variable] += hit_size;
+    if (branch_hit_sizes_[branch_variable] > max_branch_hit_size_)
+      max_branch_hit_size_ = branch_hit_sizes_[branch_variable];
+  }
+
   void add_descendant(CacheEntryID compid, CacheEntryID descendantid) {
       assert(descendantid != entry(compid).first_descendant());
       entry(descendantid).set_next_sibling(entry(compid).first_descendant());
@@ -154,7 +177,7 @@ private:
         entry(compid).set_first_descendant(entry(desc).next_sibling());
     }
 
-  std::vector<CacheableComponent *> entry_base_;
+  std::vector<T_Cacheable *> entry_base_;
   std::vector<CacheEntryID> free_entry_base_slots_;
 
   // the actual hash table
@@ -163,10 +186,17 @@ private:
 
   unsigned table_size_mask_;
 
+  // the summed size of the cache hits on the entries found
+  // in branches on each variable, and the largest such sum
+  VariableIndexedVector<uint64_t> branch_hit_sizes_;
+  uint64_t max_branch_hit_size_ = 0;
+
   DataAndStatistics &statistics_;
 
   unsigned long my_time_ = 0;
 };
+
+typedef GenericComponentCache<CacheableComponent> ComponentCache;
 } // sharpSAT namespace
 
 #include <sharpSAT/component_cache-inl.h>
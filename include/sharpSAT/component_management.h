@@ -23,16 +23,17 @@
 
 namespace sharpSAT {
 
-typedef AltComponentAnalyzer ComponentAnalyzer;
-
-class ComponentManager {
+// manages the component stack, the components found by an analyzer
+// of type T_Analyzer are cached as packed copies of type T_Cacheable
+template<class T_Analyzer, class T_Cacheable>
+class GenericComponentManager {
 public:
-  ComponentManager(SolverConfiguration &config, DataAndStatistics &statistics,
+  GenericComponentManager(SolverConfiguration &config, DataAndStatistics &statistics,
         LiteralIndexedVector<TriValue> & lit_values) :
         config_(config), cache_(statistics),
         ana_(lit_values) {
   }
-  ~ComponentManager() {
+  ~GenericComponentManager() {
       for (auto* ptr : component_stack_) {
           delete ptr;
       }
@@ -45,6 +46,19 @@ public:
       return ana_.scoreOf(v);
   }
 
+  float cacheHitScoreOf(VariableIndex v) {
+      return cache_.cacheHitScoreOf(v);
+  }
+
+  bool isArticulationPoint(VariableIndex v) {
+      return ana_.isArticulationPoint(v);
+  }
+
+  void recordArticulationPointsOf(Component &comp) {
+      ana_.recordArticulationPointsOf(comp,
+          config_.articulation_min_component_size);
+  }
+
   void cacheModelCountOf(unsigned stack_comp_id, const mpz_class &value) {
     if (config_.perform_component_caching)
       cache_.storeValueOf(component_stack_[stack_comp_id]->id(), value);
@@ -78,9 +92,15 @@ public:
   // returns true if a non-trivial non-cached component
   // has been found and is now stack_.TOS_NextComp()
   // returns false if all components have been processed;
-  inline bool findNextRemainingComponentOf(StackLevel &top);
+  // branch_variable is the decision variable of top
+  // (0 at decision level 0), literal_stack holds the assigned literals
+  inline bool findNextRemainingComponentOf(StackLevel &top,
+                                           VariableIndex branch_variable,
+                                           const std::vector<LiteralID> &literal_stack);
 
-  inline void recordRemainingCompsFor(StackLevel &top);
+  inline void recordRemainingCompsFor(StackLevel &top,
+                                      VariableIndex branch_variable,
+                                      const std::vector<LiteralID> &literal_stack);
 
   inline void sortComponentStackRange(size_t start, size_t end);
 
@@ -93,16 +113,21 @@ public:
   void removeAllCachePollutionsOf(StackLevel &top);
 
 private:
+  // caches p_new_comp or pushes it to the component stack
+  inline void recordNewComponent(StackLevel &top, Component &super_comp,
+                                 Component *p_new_comp,
+                                 VariableIndex branch_variable);
 
   SolverConfiguration &config_;
 
   std::vector<Component *> component_stack_;
-  ComponentCache cache_;
-  ComponentAnalyzer ana_;
+  GenericComponentCache<T_Cacheable> cache_;
+  T_Analyzer ana_;
 };
 
 
-void ComponentManager::sortComponentStackRange(size_t start, size_t end){
+template<class T_Analyzer, class T_Cacheable>
+void GenericComponentManager<T_Analyzer, T_Cacheable>::sortComponentStackRange(size_t start, size_t end){
     assert(start <= end);
     // We did some statistics gathering via the "easy" integration test
     // suite, and out of 158M calls to this function, 157M were for either
@@ -142,10 +167,12 @@ void ComponentManager::sortComponentStackRange(size_t start, size_t end){
 }
 
 
-bool ComponentManager::findNextRemainingComponentOf(StackLevel &top) {
+template<class T_Analyzer, class T_Cacheable>
+bool GenericComponentManager<T_Analyzer, T_Cacheable>::findNextRemainingComponentOf(StackLevel &top,
+    VariableIndex branch_variable, const std::vector<LiteralID> &literal_stack) {
     // record Remaining Components if there are none!
     if (component_stack_.size() <= top.remaining_components_ofs())
-      recordRemainingCompsFor(top);
+      recordRemainingCompsFor(top, branch_variable, literal_stack);
     assert(!top.branch_found_unsat());
     if (top.hasUnprocessedComponents())
       return true;
@@ -156,30 +183,46 @@ bool ComponentManager::findNextRemainingComponentOf(StackLevel &top) {
   }
 
 
-void ComponentManager::recordRemainingCompsFor(StackLevel &top) {
+template<class T_Analyzer, class T_Cacheable>
+void GenericComponentManager<T_Analyzer, T_Cacheable>::recordRemainingCompsFor(StackLevel &top,
+    VariableIndex branch_variable, const std::vector<LiteralID> &literal_stack) {
    Component & super_comp = superComponentOf(top);
    size_t new_comps_start_ofs = component_stack_.size();
 
-   ana_.setupAnalysisContext(top, super_comp);
-
-   for (auto vt = super_comp.varsBegin(); vt->get<VariableIndex>() != varsSENTINEL; vt++)
-     if (ana_.isUnseenAndActive(vt->get<VariableIndex>()) &&
-         ana_.exploreRemainingCompOf(vt->get<VariableIndex>())) {
-
-       Component *p_new_comp = ana_.makeComponentFromArcheType();
-       CacheableComponent *packed_comp = new CacheableComponent(ana_.getArchetype().current_comp_for_caching_);
-         if (!cache_.manageNewComponent(top, *packed_comp)){
-            component_stack_.push_back(p_new_comp);
-            p_new_comp->set_id(cache_.storeAsEntry(*packed_comp, super_comp.id()));
-         }
-         else {
-           delete packed_comp;
-           delete p_new_comp;
-         }
-     }
+   if (branch_variable != VariableIndex(0)
+       && ana_.setupIncrementalAnalysisContext(top, super_comp,
+           literal_stack.begin() + top.literal_stack_ofs(), literal_stack.end())) {
+     while (Component *p_new_comp = ana_.makeNextExploredComp())
+       recordNewComponent(top, super_comp, p_new_comp, branch_variable);
+   } else {
+     ana_.setupAnalysisContext(top, super_comp);
+
+     for (auto vt = super_comp.varsBegin(); vt->get<VariableIndex>() != varsSENTINEL; vt++)
+       if (ana_.isUnseenAndActive(vt->get<VariableIndex>()) &&
+           ana_.exploreRemainingCompOf(vt->get<VariableIndex>()))
+         recordNewComponent(top, super_comp, ana_.makeComponentFromArcheType(),
+                            branch_variable);
+   }
 
    top.set_unprocessed_components_end(component_stack_.size());
    sortComponentStackRange(new_comps_start_ofs, component_stack_.size());
 }
+
+template<class T_Analyzer, class T_Cacheable>
+void GenericComponentManager<T_Analyzer, T_Cacheable>::recordNewComponent(StackLevel &top,
+    Component &super_comp, Component *p_new_comp, VariableIndex branch_variable) {
+   T_Cacheable *packed_comp = new T_Cacheable(ana_.getArchetype().current_comp_for_caching_);
+   packed_comp->set_branch_variable(branch_variable);
+     if (!cache_.manageNewComponent(top, *packed_comp)){
+        component_stack_.push_back(p_new_comp);
+        p_new_comp->set_id(cache_.storeAsEntry(*packed_comp, super_comp.id()));
+     }
+     else {
+       delete packed_comp;
+       delete p_new_comp;
+     }
+}
+
+typedef GenericComponentManager<AltComponentAnalyzer, CacheableComponent> ComponentManager;
 } // sharpSAT namespace
 #endif /* COMPONENT_MANAGEMENT_H_ */
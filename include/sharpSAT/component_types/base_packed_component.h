@@ -147,6 +147,14 @@ public:
     return hashkey_;
   }
 
+  VariableIndex branch_variable() const {
+    return branch_variable_;
+  }
+
+  void set_branch_variable(VariableIndex v) {
+    branch_variable_ = v;
+  }
+
   bool modelCountFound(){
     return (length_solution_period_and_flags_ >> 1);
   }
@@ -184,6 +192,10 @@ protected:
 
   unsigned hashkey_ = 0;
 
+  // the decision variable of the branch in which the component was
+  // found (0 at decision level 0), stored in the gap before model_count_
+  VariableIndex branch_variable_ = VariableIndex(0);
+
   mpz_class model_count_;
 
   unsigned creation_time_ = 1;
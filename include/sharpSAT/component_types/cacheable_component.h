@@ -13,6 +13,7 @@
 
 #include <sharpSAT/primitive_types.h>
 #include <sharpSAT/component_types/difference_packed_component.h>
+#include <sharpSAT/component_types/simple_packed_component.h>
 
 namespace sharpSAT {
 
@@ -99,6 +100,6 @@ private:
 
 
 typedef GenericCacheableComponent<DifferencePackedComponent> CacheableComponent;
-//typedef GenericCacheableComponent<SimplePackedComponent> CacheableComponent;
+typedef GenericCacheableComponent<SimplePackedComponent> SimpleCacheableComponent;
 } // sharpSAT namespace
 #endif /* CACHEABLE_COMPONENT_H_ */
@@ -95,6 +95,12 @@ public:
     data_.clear();
   }
 
+  // state an analyzer saves when it first analyses the component,
+  // see AltComponentAnalyzer::setupIncrementalAnalysisContext
+  std::vector<unsigned> &saved_analysis_state() {
+    return saved_analysis_state_;
+  }
+
 private:
   // data_ stores the component data:
   // for better cache performance the
@@ -111,6 +117,8 @@ private:
   // once the model count is known, a link to the packed component will be stored
   // in the hash table
   CacheEntryID id_ = 0;
+
+  std::vector<unsigned> saved_analysis_state_;
 };
 } // sharpSAT namespace
 #endif /* COMPONENT_H_ */
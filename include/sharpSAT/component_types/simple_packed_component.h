@@ -40,6 +40,16 @@ public:
              + model_count_.get_mpz_t()->_mp_alloc * sizeof(mp_limb_t);
   }
 
+  // raw data size with the overhead
+  // for the supposed 16byte alignment of malloc
+  unsigned sys_overhead_raw_data_byte_size() const {
+    unsigned ds = data_size()* sizeof(unsigned);
+    unsigned ms = model_count_.get_mpz_t()->_mp_alloc * sizeof(mp_limb_t);
+    unsigned mask = 0xfffffff0;
+    return (ds & mask) + ((ds & 15)?16:0)
+          +(ms & mask) + ((ms & 15)?16:0);
+  }
+
   bool equals(const SimplePackedComponent &comp) const {
     if(hashkey_ != comp.hashkey())
       return false;
@@ -72,15 +82,17 @@ SimplePackedComponent::SimplePackedComponent(Component &rComp) {
   bs.stuff(data_size, bits_of_data_size());
   bs.stuff(rComp.num_variables(),bits_per_variable());
 
-  for (auto it = rComp.varsBegin(); *it != varsSENTINEL; it++) {
-    hashkey_vars = (hashkey_vars *3) + *it;
-    bs.stuff(*it, bits_per_variable());
+  for (auto it = rComp.varsBegin(); it->get<VariableIndex>() != varsSENTINEL; it++) {
+    auto star_it = static_cast<unsigned>(it->get<VariableIndex>());
+    hashkey_vars = (hashkey_vars *3) + star_it;
+    bs.stuff(star_it, bits_per_variable());
   }
 
-  if (*rComp.clsBegin())
-    for (auto jt = rComp.clsBegin(); *jt != clsSENTINEL; jt++) {
-      hashkey_clauses = (hashkey_clauses *3) + *jt;
-      bs.stuff(*jt, bits_per_clause());
+  if (rComp.clsBegin()->get<ClauseIndex>() != clsSENTINEL)
+    for (auto jt = rComp.clsBegin(); jt->get<ClauseIndex>() != clsSENTINEL; jt++) {
+      auto star_jt = static_cast<unsigned>(jt->get<ClauseIndex>());
+      hashkey_clauses = (hashkey_clauses *3) + star_jt;
+      bs.stuff(star_jt, bits_per_clause());
     }
   bs.assert_size(data_size);
 
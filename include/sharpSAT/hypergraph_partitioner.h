@@ -0,0 +1,65 @@
+/*
+ * hypergraph_partitioner.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef SHARP_SAT_HYPERGRAPH_PARTITIONER_H_
+#define SHARP_SAT_HYPERGRAPH_PARTITIONER_H_
+
+#include <vector>
+#include <random>
+
+namespace sharpSAT {
+
+/*!
+ * Multilevel bisection of a hypergraph on the vertices 0..n-1.
+ *
+ * The hypergraph is replaced by its weighted clique expansion,
+ * a hyperedge of size k adding 1 / (k - 1) to each of its pairs.
+ * The graph is coarsened by heavy edge matching, the coarsest graph
+ * bisected by greedy graph growing, and each bisection refined by
+ * boundary moves while it is projected back to the finer graphs.
+ */
+class HypergraphPartitioner {
+public:
+  /*!
+   * Bisects the hypergraph.
+   *
+   * \param[in] num_vertices the vertices are 0..num_vertices-1
+   * \param[in] hyperedges lists of vertices, hyperedges larger than
+   *            MAX_EXPANDED_EDGE_SIZE are ignored
+   * \param[out] side side[v] is the part (0 or 1) vertex v is put in
+   */
+  void bisect(unsigned num_vertices,
+              const std::vector<std::vector<unsigned>> &hyperedges,
+              std::vector<unsigned char> &side);
+
+  static const unsigned MAX_EXPANDED_EDGE_SIZE = 64;
+
+private:
+  // weighted graph in compressed adjacency form
+  struct Graph {
+    std::vector<unsigned> vertex_weights;
+    std::vector<unsigned> adjacency_ofs;
+    std::vector<unsigned> adjacency;
+    std::vector<float> edge_weights;
+
+    unsigned size() const {
+      return vertex_weights.size();
+    }
+  };
+
+  // contracts the matched pairs of g, coarse_of maps each vertex of g
+  // to its vertex in the returned graph
+  Graph coarsen(const Graph &g, std::vector<unsigned> &coarse_of);
+
+  void initialBisection(const Graph &g, std::vector<unsigned char> &side);
+
+  void refine(const Graph &g, std::vector<unsigned char> &side);
+
+  std::mt19937 random_engine_;
+};
+
+} // sharpSAT namespace
+#endif /* SHARP_SAT_HYPERGRAPH_PARTITIONER_H_ */
@@ -133,6 +133,15 @@ protected:
   //! Literal-related data, indexed by LiteralID.
   LiteralIndexedVector<Literal> literals_;
 
+  /*!
+   * Activity scores, indexed by LiteralID.
+   *
+   * Initialized to the literal's occurrences among all clauses.
+   * Kept apart from \ref literals_, so that scoring all variables of a
+   * component touches 8 bytes per variable instead of two \ref Literal.
+   */
+  LiteralIndexedVector<float> activity_scores_;
+
   //! Used in implicitBCP...
   LiteralIndexedVector<unsigned char> viewed_lits_;
 
@@ -165,20 +174,65 @@ protected:
    */
   LiteralIndexedVector<TriValue> literal_values_;
 
+  /*!
+   * Variable of the input file each variable stands for.
+   *
+   * Identity after \ref initialize, updated whenever
+   * \ref compactVariables renumbers the variables.
+   */
+  VariableIndexedVector<VariableIndex> original_var_ids_;
+
+  /*!
+   * Values of the input file variables that have been
+   * removed by \ref compactVariables because they were assigned.
+   */
+  LiteralIndexedVector<TriValue> original_literal_values_;
+
+  LiteralID originalLiteralOf(LiteralID lit) const {
+    return LiteralID(original_var_ids_[lit.var()], lit.sign());
+  }
+
+  /*!
+   * Increments added by \ref increaseActivity and \ref increaseScore.
+   *
+   * Instead of halving all activities and clause scores,
+   * \ref decayActivities doubles the increments. Both are powers of two,
+   * so that scores divided by their increment equal the decayed
+   * scores exactly. Scores are only touched again by
+   * \ref rescaleActivities, when an increment exceeds
+   * \ref SCORE_INC_LIMIT.
+   */
+  float activity_inc_ = 1.0f;
+  float clause_score_inc_ = 1.0f;
+
+  static constexpr float SCORE_INC_LIMIT = 18446744073709551616.0f; // 2^64
+
   void decayActivities() {
-    for (auto l_it = literals_.begin(); l_it != literals_.end(); l_it++)
-      l_it->activity_score_ *= 0.5;
+    activity_inc_ *= 2.0f;
+    clause_score_inc_ *= 2.0f;
+    if (activity_inc_ > SCORE_INC_LIMIT)
+      rescaleActivities();
+  }
+
+  void rescaleActivities() {
+    const float factor = 1.0f / SCORE_INC_LIMIT;
+    for (auto it = activity_scores_.begin(); it != activity_scores_.end(); it++)
+      *it *= factor;
+    activity_inc_ *= factor;
 
     for(auto clause_ofs: conflict_clauses_)
-        getHeaderOf(clause_ofs).decayScore();
+        getHeaderOf(clause_ofs).rescaleScore(factor);
+    clause_score_inc_ *= factor;
+  }
 
+  void increaseScore(ClauseOfs clause_ofs) {
+    getHeaderOf(clause_ofs).increaseScore(clause_score_inc_);
   }
-//  void decayActivities();
 
   void updateActivities(ClauseOfs clause_ofs) {
-    getHeaderOf(clause_ofs).increaseScore();
+    increaseScore(clause_ofs);
     for (auto it = beginOf(clause_ofs); *it != SENTINEL_LIT; it++) {
-      literal(*it).increaseActivity();
+      increaseActivity(*it);
     }
   }
 
@@ -231,6 +285,14 @@ protected:
     return literals_[lit];
   }
 
+  float & activity(LiteralID lit) {
+    return activity_scores_[lit];
+  }
+
+  void increaseActivity(LiteralID lit, unsigned u = 1) {
+    activity_scores_[lit] += u * activity_inc_;
+  }
+
   //! Determine if the literal is assigned the `true` value.
   inline bool isSatisfied(const LiteralID &lit) const {
     return literal_values_[lit] == TriValue::T_TRI;
@@ -297,7 +359,7 @@ ClauseOfs Instance::addClause(std::vector<LiteralID> &literals) {
   ClauseOfs cl_ofs = ClauseOfs(literal_pool_.size());
   for (auto l : literals) {
     literal_pool_.push_back(l);
-    literal(l).increaseActivity(1);
+    increaseActivity(l, 1);
   }
 
   // make an end: SENTINEL_LIT
@@ -345,8 +407,8 @@ bool Instance::addBinaryClause(LiteralID litA, LiteralID litB) {
      return false;
    literal(litA).addBinLinkTo(litB);
    literal(litB).addBinLinkTo(litA);
-   literal(litA).increaseActivity();
-   literal(litB).increaseActivity();
+   increaseActivity(litA);
+   increaseActivity(litB);
    return true;
  }
 } // sharpSAT namespace
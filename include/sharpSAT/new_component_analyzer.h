@@ -10,6 +10,7 @@
 
 
 
+#include <sharpSAT/component_analyzer.h>
 #include <sharpSAT/containers.h>
 #include <sharpSAT/stack.h>
 #include <sharpSAT/component_types/component.h>
@@ -24,17 +25,6 @@
 
 namespace sharpSAT {
 
-struct CAClauseHeader {
-  ClauseIndex clause_id = ClauseIndex(0);
-  LiteralID lit_A;
-  LiteralID lit_B;
-
-  static unsigned overheadInLits() {
-    return (sizeof(CAClauseHeader) - 2 * sizeof(LiteralID)) / sizeof(LiteralID);
-  }
-};
-
-
 class NewComponentAnalyzer;
 
 
@@ -48,6 +38,30 @@ public:
     return var_frequency_scores_[v];
   }
 
+  // articulation points are only searched by the AltComponentAnalyzer
+  // and the UFComponentAnalyzer derived from it
+  bool isArticulationPoint(VariableIndex) {
+    return false;
+  }
+
+  void recordArticulationPointsOf(Component &, unsigned) {
+  }
+
+  // incremental analysis is only done by the AltComponentAnalyzer
+  // and the UFComponentAnalyzer derived from it
+  void set_incremental_analysis(bool) {
+  }
+
+  bool setupIncrementalAnalysisContext(StackLevel &, Component &,
+      std::vector<LiteralID>::const_iterator,
+      std::vector<LiteralID>::const_iterator) {
+    return false;
+  }
+
+  Component *makeNextExploredComp() {
+    return nullptr;
+  }
+
   ComponentArchetype &current_archetype(){
     return archetype_;
   }
@@ -13,7 +13,10 @@
 #include <sharpSAT/instance.h>
 #include <sharpSAT/component_management.h>
 #include <sharpSAT/solver_config.h>
+#include <sharpSAT/solver_policies.h>
 #include <sharpSAT/stopwatch.h>
+#include <sharpSAT/tree_decomposition.h>
+#include <sharpSAT/hypergraph_partitioner.h>
 
 namespace sharpSAT {
 
@@ -21,9 +24,13 @@ enum class retStateT {
 	EXIT, RESOLVED, PROCESS_COMPONENT, BACKTRACK
 };
 
-class Solver: public Instance {
+// the counter, with its branching heuristic, component analyzer and
+// cached component type fixed at compile time by T_Policies
+// (see SolverPolicies)
+template<class T_Policies>
+class GenericSolver: public Instance {
 public:
-	Solver():
+	GenericSolver():
         comp_manager_(config_, statistics_, literal_values_) {
 		stopwatch_.setTimeBound(config_.time_bound_seconds);
 	}
@@ -66,7 +73,38 @@ private:
 
 	StopWatch stopwatch_;
 
-	ComponentManager comp_manager_;
+	GenericComponentManager<typename T_Policies::Analyzer,
+			typename T_Policies::Cacheable> comp_manager_;
+
+	// the value each variable had when it was last unassigned
+	// by reactivateTOS, X_TRI if it never was
+	VariableIndexedVector<TriValue> saved_phases_;
+	// the summed size of all cache hits found directly
+	// after a decision on the literal
+	LiteralIndexedVector<uint64_t> cache_hit_scores_;
+
+	// the number of conflicts and of cache misses at the last restart
+	unsigned long last_restart_conflicts_ = 0;
+	uint64_t last_restart_cache_misses_ = 0;
+
+	// the bonus of each variable from the tree decomposition,
+	// in [0, 1] and 1 for the variables of the root bags
+	VariableIndexedVector<float> td_scores_;
+
+	// a cut set separates the hypergraph of the super component
+	// of its decision level into two halves
+	struct CutSet {
+		int decision_level;
+		unsigned component_size;
+		std::vector<VariableIndex> vars;
+	};
+	// the cut sets of the current branch, innermost last; an empty
+	// cut set records that no small enough cut set was found
+	std::vector<CutSet> cut_sets_;
+	VariableIndexedVector<bool> in_cut_set_;
+	// the hypergraph vertex of each variable of the component bisected
+	VariableIndexedVector<unsigned> vertex_of_;
+	HypergraphPartitioner partitioner_;
 
 	// the last time conflict clauses have been deleted
 	unsigned long last_ccl_deletion_time_ = 0;
@@ -89,16 +127,49 @@ private:
 	// further data
 	void HardWireAndCompact();
 
+	// reads clauses learned by a former run on the same formula
+	// from file_name and adds those that can be verified by BCP
+	void importLearnedClauses(const std::string &file_name);
+	// writes the learned unit clauses and the best scored
+	// conflict clauses to file_name
+	void exportLearnedClauses(const std::string &file_name);
+	// true iff assigning the negation of clause leads to a conflict
+	// by unit propagation at decision level 0
+	bool isImpliedByBCP(const std::vector<LiteralID> &clause);
+
+	// computes td_scores_ from a tree decomposition of the primal graph
+	void computeTreeDecompositionScores();
+
 	SOLVER_StateT countSAT();
 
+	// looks for the next component of the top level to be processed,
+	// cache hits found on the way are credited to the decision literal
+	bool findNextRemainingComponent() {
+		uint64_t hit_sizes = statistics_.sum_cache_hit_sizes_;
+		bool found = comp_manager_.findNextRemainingComponentOf(stack_.top(),
+				stack_.get_decision_level() > 0 ?
+						TOS_decLit().var() : VariableIndex(0), literal_stack_);
+		if (stack_.get_decision_level() > 0)
+			cache_hit_scores_[TOS_decLit()] +=
+					statistics_.sum_cache_hit_sizes_ - hit_sizes;
+		return found;
+	}
+
 	void decideLiteral();
+
+	// the best scored unassigned cut set variable of comp, bisecting
+	// comp first if it is large and no cut set variable is left in it
+	// (VariableIndex(0) if there is none)
+	VariableIndex decideCutVariable(const Component &comp);
+	// pushes a cut set of comp to cut_sets_
+	void computeCutSet(const Component &comp);
 	bool bcp();
 
 
 	 void decayActivitiesOf(Component & comp) {
 	   for (auto it = comp.varsBegin(); it->get<VariableIndex>() != varsSENTINEL; it++) {
-	          literal(LiteralID(it->get<VariableIndex>(), true)).activity_score_ *=0.5;
-	          literal(LiteralID(it->get<VariableIndex>(), false)).activity_score_ *=0.5;
+	          activity(LiteralID(it->get<VariableIndex>(), true)) *=0.5;
+	          activity(LiteralID(it->get<VariableIndex>(), false)) *=0.5;
 	       }
 	}
 	///  this method performs Failed literal tests online
@@ -119,20 +190,64 @@ private:
 	// otherwise returns BACKTRACK
 	retStateT resolveConflict();
 
+	// pops all decision levels above level, discarding their
+	// assignments, their components and the cache entries created there
+	void backJumpTo(int level);
+
+	// pops all decision levels above level like backJumpTo,
+	// but without counting a back jump
+	void unwindTo(int level);
+
+	// true iff config_.restart_policy demands a restart now
+	bool restartDue();
+
+	// unwinds the decision stack to level 0, s.t. the component
+	// processed there is decided anew; learned clauses and activities
+	// are kept, and so are the cache entries except those created in
+	// open branches (their counts are only final once the branches
+	// turn out to be satisfiable)
+	void restart();
+
 	/////////////////////////////////////////////
 	//  BEGIN small helper functions
 	/////////////////////////////////////////////
 
 	float scoreOf(VariableIndex v) {
-		float score = comp_manager_.scoreOf(v);
-		score += 10.0 * literal(LiteralID(v, true)).activity_score_;
-		score += 10.0 * literal(LiteralID(v, false)).activity_score_;
-//		score += (10*stack_.get_decision_level()) * literal(LiteralID(v, true)).activity_score_;
-//		score += (10*stack_.get_decision_level()) * literal(LiteralID(v, false)).activity_score_;
+		float score = T_Policies::Branching::scoreOf(comp_manager_.scoreOf(v),
+				activity(LiteralID(v, true)), activity(LiteralID(v, false)),
+				activity_inc_);
+		score += config_.td_weight * td_scores_[v];
+		if (comp_manager_.isArticulationPoint(v))
+			score += config_.articulation_point_weight;
+		if (config_.cache_hit_weight != 0)
+			score += config_.cache_hit_weight * comp_manager_.cacheHitScoreOf(v);
+//		score += (10*stack_.get_decision_level()) * activity(LiteralID(v, true));
+//		score += (10*stack_.get_decision_level()) * activity(LiteralID(v, false));
 
 		return score;
 	}
 
+	// the sign of the decision literal on v
+	// according to config_.polarity_policy
+	bool polarityOf(VariableIndex v) {
+		LiteralID pos(v, true), neg(v, false);
+		switch (config_.polarity_policy) {
+		case PolarityPolicy::SAVED_PHASE:
+			if (saved_phases_[v] != TriValue::X_TRI)
+				return saved_phases_[v] == TriValue::T_TRI;
+			break;
+		case PolarityPolicy::NEGATIVE:
+			return false;
+		case PolarityPolicy::CACHE_HITS:
+			if (cache_hit_scores_[pos] != cache_hit_scores_[neg])
+				return cache_hit_scores_[pos] > cache_hit_scores_[neg];
+			break;
+		case PolarityPolicy::ACTIVITY:
+			break;
+		}
+		return activity(pos) > activity(neg);
+	}
+
 	/*!
 	 * Assign the literal to be `true` (if not assigned already).
 	 *
@@ -156,7 +271,7 @@ private:
 		var(lit).ante = ant;
 		literal_stack_.push_back(lit);
 		if (ant.isAClause() && ant.asCl() != NOT_A_CLAUSE)
-			getHeaderOf(ant.asCl()).increaseScore();
+			increaseScore(ant.asCl());
 		literal_values_[lit] = TriValue::T_TRI;
 		literal_values_[lit.neg()] = TriValue::F_TRI;
 		return true;
@@ -174,7 +289,7 @@ private:
 		violated_clause.push_back(litB);
 	}
 	void setConflictState(ClauseOfs cl_ofs) {
-		getHeaderOf(cl_ofs).increaseScore();
+		increaseScore(cl_ofs);
 		violated_clause.clear();
 		for (auto it = beginOf(cl_ofs); *it != SENTINEL_LIT; it++)
 			violated_clause.push_back(*it);
@@ -200,8 +315,11 @@ private:
 	}
 
 	void reactivateTOS() {
-		for (auto it = TOSLiteralsBegin(); it != literal_stack_.end(); it++)
+		for (auto it = TOSLiteralsBegin(); it != literal_stack_.end(); it++) {
+			saved_phases_[it->var()] =
+					it->sign() ? TriValue::T_TRI : TriValue::F_TRI;
 			unSet(*it);
+		}
 		comp_manager_.cleanRemainingComponentsOf(stack_.top());
 		literal_stack_.resize(stack_.top().literal_stack_ofs());
 		stack_.top().resetRemainingComps();
@@ -271,5 +389,7 @@ private:
 	//  END conflict analysis
 	/////////////////////////////////////////////
 };
+
+typedef GenericSolver<DefaultSolverPolicies> Solver;
 } // sharpSAT namespace
 #endif /* SOLVER_H_ */
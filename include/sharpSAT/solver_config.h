@@ -8,11 +8,44 @@
 #ifndef SHARP_SAT_SOLVER_CONFIG_H_
 #define SHARP_SAT_SOLVER_CONFIG_H_
 
+#include <string>
+
 namespace sharpSAT {
 
+// determines the sign of the literal decideLiteral assigns
+// to the chosen decision variable
+enum class PolarityPolicy {
+  // the literal with the higher activity score
+  ACTIVITY,
+  // the value the variable had when it was last unassigned
+  // (falls back to ACTIVITY for variables never assigned)
+  SAVED_PHASE,
+  // always the negative literal
+  NEGATIVE,
+  // the literal whose decisions led to more cached variables
+  // (falls back to ACTIVITY on ties)
+  CACHE_HITS
+};
+
+// determines when countSAT unwinds the decision stack to level 0,
+// the i-th restart follows restart_unit * luby(i) events
+// after the previous one
+enum class RestartPolicy {
+  // never restart
+  NONE,
+  // events are conflicts
+  LUBY,
+  // events are cache misses, i.e. newly stored components
+  CACHE_MISSES
+};
+
 struct SolverConfiguration {
 
-  bool perform_non_chron_back_track = true;
+  // jump back to the highest decision level of a conflict clause
+  // that does not contain a literal of the current level
+  // (off by default: the cache entries discarded by the jumps
+  // tend to cost more than the decisions saved)
+  bool perform_non_chron_back_track = false;
 
   // TODO component caching cannot be deactivated for now!
   bool perform_component_caching = true;
@@ -21,6 +54,62 @@ struct SolverConfiguration {
 
   unsigned long time_bound_seconds = 100000;
 
+  PolarityPolicy polarity_policy = PolarityPolicy::ACTIVITY;
+
+  // after preprocessing, an approximate tree decomposition of the primal
+  // graph is computed, the branching score of each variable is increased
+  // by td_weight * (1 - depth / height) of the variable in it
+  // (td_weight = 0 turns this off; off by default: it speeds up
+  // most structured instances, but slows down some Bayesian network
+  // encodings by more than an order of magnitude; 10 works well otherwise)
+  double td_weight = 0;
+  double td_time_bound_seconds = 2.0;
+  // the elimination gives up on bags larger than this
+  unsigned td_max_width = 500;
+
+  // before each decision, the articulation points of the component are
+  // computed, i.e. the variables whose assignment splits it, if it has at
+  // least articulation_min_component_size variables; their branching
+  // score is increased by articulation_point_weight
+  // (articulation_point_weight = 0 turns this off)
+  double articulation_point_weight = 0;
+  unsigned articulation_min_component_size = 32;
+
+  // the cache credits each hit to the decision variable of the branch
+  // in which the entry hit was stored, the branching score of a variable
+  // is increased by cache_hit_weight * (its credit / the largest credit)
+  // (cache_hit_weight = 0 turns this off; it pays off on structured
+  // instances, but slows the search on the less structured ones)
+  double cache_hit_weight = 0;
+
+  // at decision levels above 0, the components are searched for from
+  // the literals assigned at the level instead of in the whole component
+  // branched on, see AltComponentAnalyzer::setupIncrementalAnalysisContext
+  // (only the alt analyzer supports this)
+  bool perform_incremental_analysis = false;
+
+  // components of at least this many variables are bisected by
+  // a hypergraph partitioner, decisions then go to the variables of the
+  // smallest cut first; a cut set is rejected if it holds more than
+  // cutset_max_fraction of the variables
+  // (cutset_min_component_size = 0 turns this off)
+  unsigned cutset_min_component_size = 0;
+  double cutset_max_fraction = 0.2;
+
+  // (off by default: a restart discards all counts
+  // of the open branches below the current top level component)
+  RestartPolicy restart_policy = RestartPolicy::NONE;
+  unsigned long restart_unit = 512;
+
+  // learned clauses are read from learned_clauses_in_file before the
+  // search starts and written to learned_clauses_out_file after it ended,
+  // both in DIMACS format over the variables of the input file
+  // (an empty file name turns the respective step off)
+  std::string learned_clauses_in_file;
+  std::string learned_clauses_out_file;
+  // at most this many of the highest scored learned clauses are written
+  unsigned long max_learned_clauses_out = 100000;
+
   bool verbose = false;
 
   // quiet = true will override verbose;
@@ -0,0 +1,68 @@
+/*
+ * solver_policies.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef SHARP_SAT_SOLVER_POLICIES_H_
+#define SHARP_SAT_SOLVER_POLICIES_H_
+
+#include <sharpSAT/alt_component_analyzer.h>
+#include <sharpSAT/component_analyzer.h>
+#include <sharpSAT/new_component_analyzer.h>
+#include <sharpSAT/uf_component_analyzer.h>
+#include <sharpSAT/component_types/cacheable_component.h>
+
+namespace sharpSAT {
+
+// A branching policy scores the variables of the component branched on.
+// It combines the score the component analyzer gives the variable
+// (the number of its occurrences in the active clauses of the component)
+// with the activities of its two literals, both relative to the current
+// activity increment. The solver adds the scores of its optional
+// heuristics (tree decomposition, articulation points) to the result.
+
+// variable state aware decaying sum, activities weigh ten times as
+// much as occurrences
+struct VSADSBranching {
+  static constexpr double ACTIVITY_WEIGHT = 10.0;
+
+  static float scoreOf(unsigned occurrences, float pos_activity,
+                       float neg_activity, float activity_inc) {
+    float score = occurrences;
+    score += ACTIVITY_WEIGHT * pos_activity / activity_inc;
+    score += ACTIVITY_WEIGHT * neg_activity / activity_inc;
+    return score;
+  }
+};
+
+// dynamic largest combined sum of occurrences, the activities weigh
+// a hundredth of an occurrence (slower than VSADSBranching on most
+// of the structured benchmarks)
+struct OccurrenceBranching {
+  static constexpr double ACTIVITY_WEIGHT = 0.01;
+
+  static float scoreOf(unsigned occurrences, float pos_activity,
+                       float neg_activity, float activity_inc) {
+    float score = occurrences;
+    score += ACTIVITY_WEIGHT * pos_activity / activity_inc;
+    score += ACTIVITY_WEIGHT * neg_activity / activity_inc;
+    return score;
+  }
+};
+
+// The policies a GenericSolver is compiled for: the branching policy,
+// the component analyzer and the type of the cached packed components.
+// Each combination main can select at startup is instantiated
+// explicitly in solver.cpp.
+template<class T_Branching, class T_Analyzer, class T_Cacheable>
+struct SolverPolicies {
+  typedef T_Branching Branching;
+  typedef T_Analyzer Analyzer;
+  typedef T_Cacheable Cacheable;
+};
+
+typedef SolverPolicies<VSADSBranching, AltComponentAnalyzer,
+                       CacheableComponent> DefaultSolverPolicies;
+} // sharpSAT namespace
+#endif /* SHARP_SAT_SOLVER_POLICIES_H_ */
@@ -125,8 +125,11 @@ public:
   bool branch_found_unsat() {
     return branch_found_unsat_[active_branch_];
   }
+  // also drops the solutions of components already
+  // processed in this branch (after a back jump)
   void mark_branch_unsat() {
     branch_found_unsat_[active_branch_] = true;
+    branch_model_count_[active_branch_] = 0;
   }
 
 //  void set_both_branches_unsat(){
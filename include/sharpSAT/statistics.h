@@ -63,15 +63,32 @@ public:
   unsigned long num_failed_literal_tests_ = 0;
   // number of all conflicts occurred
   unsigned long num_conflicts_ = 0;
+  // number of non-chronological back jumps and the levels skipped by them
+  unsigned long num_back_jumps_ = 0;
+  unsigned long num_levels_jumped_ = 0;
+  // number of restarts of the search
+  unsigned long num_restarts_ = 0;
+  // number of cut sets branched on / rejected as too large,
+  // and the summed size of those branched on
+  unsigned long num_cut_sets_ = 0;
+  unsigned long num_cut_sets_rejected_ = 0;
+  unsigned long sum_cut_set_sizes_ = 0;
 
   // number of clauses overall learned
   unsigned num_clauses_learned_ = 0;
 
+  // learned clauses read from a file that were added / rejected
+  unsigned long num_learned_clauses_imported_ = 0;
+  unsigned long num_learned_clauses_rejected_ = 0;
+  // learned clauses written to a file
+  unsigned long num_learned_clauses_exported_ = 0;
+
 
   /* cache statistics */
   uint64_t num_cache_hits_ = 0;
   uint64_t num_cache_look_ups_ = 0;
   uint64_t sum_cache_hit_sizes_ = 0;
+  uint64_t sum_cache_look_up_sizes_ = 0;
 
   uint64_t num_cached_components_ = 0;
   uint64_t sum_size_cached_components_ = 0;
@@ -113,7 +130,8 @@ public:
              + overall_bytes_components_stored_;
     }
 
-  void incorporate_cache_store(CacheableComponent &ccomp){
+  template<class T_Cacheable>
+  void incorporate_cache_store(T_Cacheable &ccomp){
     sum_bytes_cached_components_ += ccomp.SizeInBytes();
     sum_size_cached_components_ += ccomp.num_variables();
     num_cached_components_++;
@@ -126,7 +144,8 @@ public:
     sum_bytes_pure_cached_component_data_ += ccomp.data_only_byte_size();
     overall_bytes_pure_stored_component_data_ += ccomp.data_only_byte_size();
   }
-  void incorporate_cache_erase(CacheableComponent &ccomp){
+  template<class T_Cacheable>
+  void incorporate_cache_erase(T_Cacheable &ccomp){
       sum_bytes_cached_components_ -= ccomp.SizeInBytes();
       sum_size_cached_components_ -= ccomp.num_variables();
       num_cached_components_--;
@@ -135,7 +154,8 @@ public:
       sys_overhead_sum_bytes_cached_components_ -= ccomp.sys_overhead_SizeInBytes();
   }
 
-  void incorporate_cache_hit(CacheableComponent &ccomp){
+  template<class T_Cacheable>
+  void incorporate_cache_hit(T_Cacheable &ccomp){
       num_cache_hits_++;
       sum_cache_hit_sizes_ += ccomp.num_variables();
   }
@@ -225,6 +245,13 @@ public:
         / (double) num_cache_look_ups_;
   }
 
+  // the share of the variables of all components looked up
+  // that were found in the cache
+  double cache_hit_variable_rate() {
+    if(sum_cache_look_up_sizes_ == 0) return 0.0;
+    return sum_cache_hit_sizes_ / (double) sum_cache_look_up_sizes_;
+  }
+
   long double getAvgCacheHitSize() {
     if(num_cache_hits_ == 0) return 0.0;
     return sum_cache_hit_sizes_ / (long double) num_cache_hits_;
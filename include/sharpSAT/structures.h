@@ -127,13 +127,6 @@ public:
    */
   std::vector<ClauseOfs> watch_list_ = std::vector<ClauseOfs>(1,SENTINEL_CL);
 
-  //! Initialized to literal's occurances among all clauses
-  float activity_score_ = 0.0f;
-
-  void increaseActivity(unsigned u = 1){
-    activity_score_+= u;
-  }
-
   void removeWatchLinkTo(ClauseOfs clause_ofs) {
     for (auto it = watch_list_.begin(); it != watch_list_.end(); it++)
           if (*it == clause_ofs) {
@@ -261,17 +254,17 @@ struct Variable {
  */
 class ClauseHeader {
   unsigned creation_time_; // number of conflicts seen at creation time
-  unsigned score_;
+  float score_;
   unsigned length_;
 public:
 
-  void increaseScore() {
-    score_++;
+  void increaseScore(float inc = 1.0f) {
+    score_ += inc;
   }
-  void decayScore() {
-      score_ >>= 1;
+  void rescaleScore(float factor) {
+      score_ *= factor;
   }
-  unsigned score() {
+  float score() {
       return score_;
   }
 
@@ -0,0 +1,93 @@
+/*
+ * tree_decomposition.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef SHARP_SAT_TREE_DECOMPOSITION_H_
+#define SHARP_SAT_TREE_DECOMPOSITION_H_
+
+#include <vector>
+
+namespace sharpSAT {
+
+/*!
+ * Approximate tree decomposition of a graph on the vertices 1..n.
+ *
+ * Vertices are eliminated greedily by minimum degree. Eliminating v yields
+ * the bag of v and its neighbours at that time, whose parent is the bag of
+ * the neighbour eliminated next. If the elimination hits its time bound or
+ * its width bound, the vertices left over form one more bag.
+ *
+ * Each tree of the resulting forest is rooted at its center. The depth of
+ * a vertex is the distance from the root to the topmost bag containing it;
+ * branching on vertices of small depth first splits the graph early.
+ */
+class TreeDecomposition {
+public:
+  /*!
+   * Decomposes the graph.
+   *
+   * \param[in] graph graph[v] lists the neighbours of v, graph[0] is unused
+   * \param[in] time_bound_seconds the elimination stops after this time
+   * \param[in] max_width the elimination stops once every vertex left
+   *            has more neighbours than this
+   */
+  void compute(std::vector<std::vector<unsigned>> graph,
+               double time_bound_seconds, unsigned max_width);
+
+  //! Largest bag size minus one.
+  unsigned width() const {
+    return width_;
+  }
+
+  //! Largest depth of a vertex.
+  unsigned height() const {
+    return height_;
+  }
+
+  //! False iff the elimination stopped early.
+  bool completed() const {
+    return completed_;
+  }
+
+  unsigned depth(unsigned v) const {
+    return depth_[v];
+  }
+
+private:
+  // bags_[v] holds the neighbours of v when v was eliminated,
+  // bags_[0] the vertices left over (the extra bag)
+  std::vector<std::vector<unsigned>> bags_;
+  // the bag following bags_[v] in elimination order, NO_BAG for roots
+  std::vector<unsigned> parent_;
+  std::vector<unsigned> children_ofs_;
+  std::vector<unsigned> children_;
+  // the number of vertices eliminated before v, NO_BAG if v is left over
+  std::vector<unsigned> position_;
+  std::vector<unsigned> depth_;
+
+  // scratch space of the breadth first searches over bags
+  std::vector<unsigned> distance_;
+  std::vector<unsigned> predecessor_;
+  std::vector<unsigned> visited_;
+
+  unsigned width_ = 0;
+  unsigned height_ = 0;
+  bool completed_ = false;
+
+  static const unsigned NO_BAG = ~0u;
+
+  void eliminate(std::vector<std::vector<unsigned>> &graph,
+                 double time_bound_seconds, unsigned max_width);
+
+  // visits the tree containing bag start, leaves the bags in visited_
+  // and their distance to start in distance_
+  void breadthFirstSearch(unsigned start);
+
+  // sets depth_ for all vertices of the tree containing bag root
+  void rootAtCenter(unsigned root);
+};
+
+} // sharpSAT namespace
+#endif /* SHARP_SAT_TREE_DECOMPOSITION_H_ */
@@ -0,0 +1,109 @@
+/*
+ * uf_component_analyzer.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef SHARP_SAT_UF_COMPONENT_ANALYZER_H_
+#define SHARP_SAT_UF_COMPONENT_ANALYZER_H_
+
+#include <sharpSAT/alt_component_analyzer.h>
+
+#include <utility>
+#include <vector>
+
+namespace sharpSAT {
+
+// Finds the components of the super component by union-find instead of
+// a search: one sweep over the link lists of its active variables unites
+// each variable with the variables it shares an active binary clause or
+// an unsatisfied clause with. The components are then collected by their
+// roots in one pass over the super component.
+// The link lists, the articulation points and the incremental analysis
+// are those of the AltComponentAnalyzer. The score of a variable counts
+// all of its active binary clauses, as with incremental analysis, since
+// the sweep has no search order to count the binary clauses along.
+class UFComponentAnalyzer : public AltComponentAnalyzer {
+public:
+  UFComponentAnalyzer(LiteralIndexedVector<TriValue> & lit_values) :
+      AltComponentAnalyzer(lit_values) {
+  }
+
+  void initialize(LiteralIndexedVector<Literal> & literals,
+      std::vector<LiteralID> &lit_pool);
+
+  // true iff v is the first variable of a component of the last
+  // call to setupAnalysisContext not made yet
+  bool isUnseenAndActive(VariableIndex v) {
+    assert(v <= max_variable_id_);
+    return archetype_.var_unseen_in_sup_comp(v)
+        && comp_vars_[comp_var_ofs_[comp_of_[v]]] == v;
+  }
+
+  // finds all components of super_comp
+  void setupAnalysisContext(StackLevel &top, Component & super_comp);
+
+  // returns true, iff the component of v is non-trivial
+  bool exploreRemainingCompOf(VariableIndex v) {
+    assert(isUnseenAndActive(v));
+    archetype_.setVar_in_other_comp(v);
+    current_comp_ = comp_of_[v];
+    if (comp_var_ofs_[current_comp_ + 1] - comp_var_ofs_[current_comp_] == 1) {
+      archetype_.stack_level().includeSolution(2);
+      return false;
+    }
+    return true;
+  }
+
+  Component *makeComponentFromArcheType();
+
+private:
+  // the parent of a variable in its set, roots are their own parents
+  VariableIndexedVector<VariableIndex> set_parent_;
+  VariableIndexedVector<unsigned char> set_rank_;
+
+  // the component of each variable of the super component
+  VariableIndexedVector<unsigned> comp_of_;
+
+  // the variables and clauses of component c, in the order of the
+  // super component: [comp_var_ofs_[c], comp_var_ofs_[c + 1]) of
+  // comp_vars_ and likewise for the clauses
+  std::vector<VariableIndex> comp_vars_;
+  std::vector<unsigned> comp_var_ofs_;
+  std::vector<ClauseIndex> comp_clauses_;
+  std::vector<unsigned> comp_clause_ofs_;
+
+  // a variable of each clause seen, it shares the set of all of them
+  std::vector<VariableIndex> clause_var_;
+
+  unsigned current_comp_ = 0;
+
+  VariableIndex findSet(VariableIndex v) {
+    while (set_parent_[v] != v)
+      v = set_parent_[v] = set_parent_[set_parent_[v]];
+    return v;
+  }
+
+  // unites the sets of u and v, returns false if they were one already
+  bool uniteSets(VariableIndex u, VariableIndex v) {
+    u = findSet(u);
+    v = findSet(v);
+    if (u == v)
+      return false;
+    if (set_rank_[u] < set_rank_[v])
+      std::swap(u, v);
+    set_parent_[v] = u;
+    if (set_rank_[u] == set_rank_[v])
+      set_rank_[u]++;
+    return true;
+  }
+
+  void uniteThroughLinksOf(VariableIndex v);
+
+  // the clause clID of more than three literals (v's excluded)
+  // starting at pstart_cls
+  void uniteThroughClause(VariableIndex v, ClauseIndex clID, LinkIterator pstart_cls);
+};
+
+} // sharpSAT namespace
+#endif /* SHARP_SAT_UF_COMPONENT_ANALYZER_H_ */
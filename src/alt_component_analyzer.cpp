@@ -8,6 +8,8 @@
 
 #include <sharpSAT/alt_component_analyzer.h>
 
+#include <algorithm>
+
 using namespace std;
 
 namespace sharpSAT {
@@ -21,6 +23,8 @@ void AltComponentAnalyzer::initialize(LiteralIndexedVector<Literal> & literals,
 
   search_stack_.reserve(max_variable_id + 1);
   var_frequency_scores_.resize(max_variable_id + 1, 0);
+  articulation_points_.clear();
+  articulation_points_.resize(max_variable_id + 1, false);
   variable_occurrence_lists_pool_.clear();
   variable_link_list_offsets_.clear();
   variable_link_list_offsets_.resize(max_variable_id + 1, 0);
@@ -33,14 +37,20 @@ void AltComponentAnalyzer::initialize(LiteralIndexedVector<Literal> & literals,
   max_clause_id_ = ClauseIndex(0);
   unsigned curr_clause_length = 0;
   auto it_curr_cl_st = lit_pool.begin();
+  clause_literals_.clear();
+  clause_literals_ofs_.assign(1, 0);
 
   for (auto it_lit = lit_pool.begin(); it_lit < lit_pool.end(); it_lit++) {
     if (*it_lit == SENTINEL_LIT) {
+      if (incremental_analysis_ && max_clause_id_ != ClauseIndex(0))
+        clause_literals_.push_back(SENTINEL_LIT);
 
       if (it_lit + 1 == lit_pool.end())
         break;
 
       ++max_clause_id_;
+      if (incremental_analysis_)
+        clause_literals_ofs_.push_back(clause_literals_.size());
       it_lit += ClauseHeader::overheadInLits();
       it_curr_cl_st = it_lit + 1;
       curr_clause_length = 0;
@@ -48,6 +58,8 @@ void AltComponentAnalyzer::initialize(LiteralIndexedVector<Literal> & literals,
     } else {
       assert(it_lit->var() <= max_variable_id_);
       curr_clause_length++;
+      if (incremental_analysis_)
+        clause_literals_.push_back(*it_lit);
 
       getClause(tmp, it_curr_cl_st, it_lit->var());
 
@@ -78,6 +90,17 @@ void AltComponentAnalyzer::initialize(LiteralIndexedVector<Literal> & literals,
   }
 
   ComponentArchetype::initArrays(max_variable_id_, max_clause_id_);
+  dfs_index_.assign(max_variable_id + static_cast<unsigned>(max_clause_id_) + 1, 0);
+  dfs_low_.assign(dfs_index_.size(), 0);
+  dfs_member_.assign(dfs_index_.size(), 0);
+  dfs_counter_ = dfs_round_ = 0;
+  if (incremental_analysis_) {
+    unsigned num_clause_ids = static_cast<unsigned>(max_clause_id_) + 1;
+    clause_has_false_lit_.assign(num_clause_ids, false);
+    next_clause_.assign(num_clause_ids, ClauseIndex(0));
+    tree_links_.assign(max_variable_id + 1,
+                       TreeLinks{0, VariableIndex(0), VariableIndex(0)});
+  }
   // the unified link list
   unified_variable_links_lists_pool_.clear();
   unified_variable_links_lists_pool_.push_back(0u);
@@ -175,7 +198,12 @@ void AltComponentAnalyzer::recordComponentOf(const VariableIndex var) {
     assert(isActive(*vt));
     auto p = beginOfLinkList(*vt);
     for (; p->get<VariableIndex>() != varsSENTINEL; p++) {
-      if(manageSearchOccurrenceOf(LiteralID(p->get<VariableIndex>(),true))){
+      if (incremental_analysis_) {
+        // the incremental analysis needs scores independent of the search
+        if (isActive(p->get<VariableIndex>()))
+          var_frequency_scores_[*vt]++;
+        manageSearchOccurrenceOf(LiteralID(p->get<VariableIndex>(),true));
+      } else if(manageSearchOccurrenceOf(LiteralID(p->get<VariableIndex>(),true))){
         var_frequency_scores_[p->get<VariableIndex>()]++;
         var_frequency_scores_[*vt]++;
       }
@@ -205,4 +233,399 @@ void AltComponentAnalyzer::recordComponentOf(const VariableIndex var) {
   }
 }
 
+bool AltComponentAnalyzer::setupIncrementalAnalysisContext(StackLevel &top,
+    Component &super_comp, vector<LiteralID>::const_iterator lits_begin,
+    vector<LiteralID>::const_iterator lits_end) {
+  if (!incremental_analysis_)
+    return false;
+  archetype_.reInitialize(top, super_comp);
+
+  // the scores and flags are still those left by the analysis that found
+  // super_comp when it is analysed the first time, they are saved with it
+  // then and restored on later analyses
+  vector<unsigned> &saved = super_comp.saved_analysis_state();
+  bool restore = !saved.empty();
+  unsigned i = 0;
+  if (!restore)
+    saved.reserve(super_comp.num_variables() + super_comp.numLongClauses());
+  for (auto vt = super_comp.varsBegin(); vt->get<VariableIndex>() != varsSENTINEL; vt++) {
+    VariableIndex v = vt->get<VariableIndex>();
+    if (restore)
+      var_frequency_scores_[v] = saved[i++];
+    else
+      saved.push_back(var_frequency_scores_[v]);
+    if (isActive(v))
+      archetype_.setVar_in_sup_comp_unseen(v);
+  }
+  for (auto itCl = super_comp.clsBegin(); itCl->get<ClauseIndex>() != clsSENTINEL; itCl++) {
+    unsigned cl = static_cast<unsigned>(itCl->get<ClauseIndex>());
+    if (restore)
+      clause_has_false_lit_[cl] = saved[i++];
+    else
+      saved.push_back(clause_has_false_lit_[cl]);
+    archetype_.setClause_in_sup_comp_unseen(itCl->get<ClauseIndex>());
+  }
+
+  trees_.clear();
+  growing_trees_.clear();
+  complete_trees_.clear();
+  num_growing_trees_ = 0;
+  next_complete_tree_ = 0;
+
+  // seed the trees, a literal assigned at top but outside of super_comp
+  // (set by a unit clause) is adjacent to no variable of super_comp
+  for (auto it = lits_begin; it != lits_end; it++) {
+    auto p = beginOfLinkList(it->var());
+    for (; p->get<VariableIndex>() != varsSENTINEL; p++)
+      if (inSuperComp(p->get<VariableIndex>())) {
+        var_frequency_scores_[p->get<VariableIndex>()]--;
+        if (archetype_.var_unseen_in_sup_comp(p->get<VariableIndex>()))
+          newTree(p->get<VariableIndex>());
+      }
+    for (p++; static_cast<unsigned>(*p); p += 3)
+      if (archetype_.clause_unseen_in_sup_comp(p->get<ClauseIndex>()))
+        manageTouchedClause(p->get<ClauseIndex>());
+    for (p++; p->get<ClauseIndex>() != clsSENTINEL; p += 2)
+      if (archetype_.clause_unseen_in_sup_comp(p->get<ClauseIndex>()))
+        manageTouchedClause(p->get<ClauseIndex>());
+  }
+
+  // grow the trees in turns, one variable at a time
+  while (num_growing_trees_ > 1) {
+    unsigned num_kept = 0;
+    for (unsigned j = 0; j < growing_trees_.size() && num_growing_trees_ > 1; j++) {
+      unsigned t = growing_trees_[j];
+      if (trees_[t].parent != t)
+        continue;
+      if (trees_[t].pending_head == VariableIndex(0)) {
+        complete_trees_.push_back(std::make_pair(trees_[t].first_var, t));
+        num_growing_trees_--;
+        continue;
+      }
+      expandTree(t);
+      growing_trees_[num_kept++] = t;
+    }
+    growing_trees_.resize(num_kept);
+  }
+
+  // the complete trees leave the rest of super_comp
+  unsigned num_kept = 0;
+  for (auto &tree : complete_trees_) {
+    VariableIndex v = tree.first;
+    do {
+      archetype_.setVar_in_other_comp(v);
+      tree.first = std::min(tree.first, v);
+      v = tree_links_[v].next;
+    } while (v != trees_[tree.second].first_var);
+    if (trees_[tree.second].size == 1) {
+      top.includeSolution(2);
+      continue;
+    }
+    ClauseIndex first_clause = trees_[tree.second].first_clause, cl = first_clause;
+    if (cl != ClauseIndex(0))
+      do {
+        archetype_.setClause_in_other_comp(cl);
+        cl = next_clause_[static_cast<unsigned>(cl)];
+      } while (cl != first_clause);
+    complete_trees_[num_kept++] = tree;
+  }
+  complete_trees_.resize(num_kept);
+  std::sort(complete_trees_.begin(), complete_trees_.end());
+
+  rest_pending_ = num_growing_trees_ == 1;
+  if (rest_pending_) {
+    auto vt = super_comp.varsBegin();
+    while (!inSuperComp(vt->get<VariableIndex>()))
+      vt++;
+    rest_first_var_ = vt->get<VariableIndex>();
+  }
+  return true;
+}
+
+void AltComponentAnalyzer::manageTouchedClause(ClauseIndex cl) {
+  auto begin = clause_literals_.begin()
+      + clause_literals_ofs_[static_cast<unsigned>(cl)];
+  bool satisfied = false;
+  for (auto it = begin; *it != SENTINEL_LIT; it++)
+    satisfied |= isSatisfied(*it);
+
+  if (satisfied) {
+    archetype_.setClause_nil(cl);
+    for (auto it = begin; *it != SENTINEL_LIT; it++)
+      if (inSuperComp(it->var())) {
+        var_frequency_scores_[it->var()]--;
+        if (archetype_.var_unseen_in_sup_comp(it->var()))
+          newTree(it->var());
+      }
+    return;
+  }
+  clause_has_false_lit_[static_cast<unsigned>(cl)] = true;
+  unsigned t = ~0u;
+  for (auto it = begin; *it != SENTINEL_LIT; it++)
+    t = manageTreeOccurrenceOf(t, *it);
+  // unit propagation leaves at least two active literals
+  assert(t != ~0u);
+  addClauseToTree(t, cl);
+}
+
+unsigned AltComponentAnalyzer::mergeTrees(unsigned s, unsigned t) {
+  if (trees_[s].size < trees_[t].size)
+    std::swap(s, t);
+  SearchTree &root = trees_[s], &child = trees_[t];
+  child.parent = s;
+  root.size += child.size;
+  std::swap(tree_links_[root.first_var].next, tree_links_[child.first_var].next);
+  if (root.first_clause == ClauseIndex(0))
+    root.first_clause = child.first_clause;
+  else if (child.first_clause != ClauseIndex(0))
+    std::swap(next_clause_[static_cast<unsigned>(root.first_clause)],
+              next_clause_[static_cast<unsigned>(child.first_clause)]);
+  if (root.pending_head == VariableIndex(0)) {
+    root.pending_head = child.pending_head;
+    root.pending_tail = child.pending_tail;
+  } else if (child.pending_head != VariableIndex(0)) {
+    tree_links_[root.pending_tail].next_pending = child.pending_head;
+    root.pending_tail = child.pending_tail;
+  }
+  num_growing_trees_--;
+  return s;
+}
+
+void AltComponentAnalyzer::expandTree(unsigned t) {
+  VariableIndex v = trees_[t].pending_head;
+  trees_[t].pending_head = tree_links_[v].next_pending;
+
+  auto p = beginOfLinkList(v);
+  for (; p->get<VariableIndex>() != varsSENTINEL; p++)
+    t = manageTreeOccurrenceOf(t, LiteralID(p->get<VariableIndex>(), true));
+
+  // the clauses not seen yet have not been touched by the assignment,
+  // they are neither satisfied nor do they lose literals
+  for (p++; static_cast<unsigned>(*p); p += 3)
+    if (archetype_.clause_unseen_in_sup_comp(p->get<ClauseIndex>())) {
+      addClauseToTree(t, p->get<ClauseIndex>());
+      t = manageTreeOccurrenceOf(t, (p + 1)->get<LiteralID>());
+      t = manageTreeOccurrenceOf(t, (p + 2)->get<LiteralID>());
+    }
+
+  for (p++; p->get<ClauseIndex>() != clsSENTINEL; p += 2)
+    if (archetype_.clause_unseen_in_sup_comp(p->get<ClauseIndex>())) {
+      addClauseToTree(t, p->get<ClauseIndex>());
+      for (auto itL = p + 1 + static_cast<unsigned>((p + 1)->get<ClauseIndex>());
+           static_cast<unsigned>(*itL) != 0; itL++)
+        t = manageTreeOccurrenceOf(t, itL->get<LiteralID>());
+    }
+}
+
+Component *AltComponentAnalyzer::makeNextExploredComp() {
+  if (next_complete_tree_ < complete_trees_.size()
+      && !(rest_pending_ && rest_first_var_ < complete_trees_[next_complete_tree_].first))
+    return makeComponentFromTree(complete_trees_[next_complete_tree_++].second);
+  if (!rest_pending_)
+    return nullptr;
+  rest_pending_ = false;
+
+  // the rest of the super component, the clauses not seen
+  // have not been touched by the assignment
+  Component &super_comp = archetype_.super_comp();
+  Component &cache_key = archetype_.current_comp_for_caching_;
+  Component *p_new_comp = new Component();
+  p_new_comp->reserveSpace(super_comp.num_variables(), super_comp.numLongClauses());
+  cache_key.clear();
+  for (auto vt = super_comp.varsBegin(); vt->get<VariableIndex>() != varsSENTINEL; vt++)
+    if (inSuperComp(vt->get<VariableIndex>())) {
+      p_new_comp->addVar(vt->get<VariableIndex>());
+      cache_key.addVar(vt->get<VariableIndex>());
+    }
+  p_new_comp->closeVariableData();
+  cache_key.closeVariableData();
+
+  if (p_new_comp->num_variables() == 1) {
+    archetype_.stack_level().includeSolution(2);
+    delete p_new_comp;
+    return makeNextExploredComp();
+  }
+
+  for (auto itCl = super_comp.clsBegin(); itCl->get<ClauseIndex>() != clsSENTINEL; itCl++) {
+    ClauseIndex cl = itCl->get<ClauseIndex>();
+    if (archetype_.clause_unseen_in_sup_comp(cl) || archetype_.clause_seen(cl)) {
+      p_new_comp->addCl(cl);
+      if (clause_has_false_lit_[static_cast<unsigned>(cl)])
+        cache_key.addCl(cl);
+    }
+  }
+  p_new_comp->closeClauseData();
+  cache_key.closeClauseData();
+  return p_new_comp;
+}
+
+Component *AltComponentAnalyzer::makeComponentFromTree(unsigned t) {
+  SearchTree &tree = trees_[t];
+  // components list their variables and clauses in ascending order
+  search_stack_.clear();
+  VariableIndex v = tree.first_var;
+  do {
+    search_stack_.push_back(v);
+    v = tree_links_[v].next;
+  } while (v != tree.first_var);
+  std::sort(search_stack_.begin(), search_stack_.end());
+
+  clauses_found_.clear();
+  ClauseIndex cl = tree.first_clause;
+  if (cl != ClauseIndex(0))
+    do {
+      clauses_found_.push_back(cl);
+      cl = next_clause_[static_cast<unsigned>(cl)];
+    } while (cl != tree.first_clause);
+  std::sort(clauses_found_.begin(), clauses_found_.end());
+
+  Component &cache_key = archetype_.current_comp_for_caching_;
+  Component *p_new_comp = new Component();
+  p_new_comp->reserveSpace(tree.size, clauses_found_.size());
+  cache_key.clear();
+  for (auto v : search_stack_) {
+    p_new_comp->addVar(v);
+    cache_key.addVar(v);
+  }
+  p_new_comp->closeVariableData();
+  cache_key.closeVariableData();
+  for (auto cl : clauses_found_) {
+    p_new_comp->addCl(cl);
+    if (clause_has_false_lit_[static_cast<unsigned>(cl)])
+      cache_key.addCl(cl);
+  }
+  p_new_comp->closeClauseData();
+  cache_key.closeClauseData();
+  return p_new_comp;
+}
+
+void AltComponentAnalyzer::recordArticulationPointsOf(Component &comp,
+    unsigned min_size) {
+  for (auto vt = comp.varsBegin(); vt->get<VariableIndex>() != varsSENTINEL; vt++)
+    articulation_points_[vt->get<VariableIndex>()] = false;
+  if (comp.num_variables() < min_size)
+    return;
+
+  // restart the indices before they could overflow
+  if (dfs_counter_ > ~0u - dfs_index_.size()) {
+    std::fill(dfs_index_.begin(), dfs_index_.end(), 0);
+    dfs_counter_ = 0;
+  }
+  if (++dfs_round_ == 0) {
+    std::fill(dfs_member_.begin(), dfs_member_.end(), 0);
+    dfs_round_ = 1;
+  }
+  unsigned start = dfs_counter_;
+  unsigned clause_node_ofs = static_cast<unsigned>(max_variable_id_);
+
+  for (auto vt = comp.varsBegin(); vt->get<VariableIndex>() != varsSENTINEL; vt++)
+    dfs_member_[static_cast<unsigned>(vt->get<VariableIndex>())] = dfs_round_;
+  for (auto itCl = comp.clsBegin(); itCl->get<ClauseIndex>() != clsSENTINEL; itCl++)
+    dfs_member_[clause_node_ofs + static_cast<unsigned>(itCl->get<ClauseIndex>())] = dfs_round_;
+  auto isMember = [&](unsigned node) {
+    return dfs_member_[node] == dfs_round_;
+  };
+
+  VariableIndex var = comp.varsBegin()->get<VariableIndex>();
+  unsigned root = static_cast<unsigned>(var);
+  unsigned root_children = 0;
+
+  auto visit = [&](unsigned node, LinkIterator pos, DFSPhase phase,
+      unsigned remaining) {
+    dfs_index_[node] = dfs_low_[node] = ++dfs_counter_;
+    dfs_stack_.push_back(DFSFrame{node, pos, phase, remaining});
+  };
+
+  dfs_stack_.clear();
+  visit(root, beginOfLinkList(var), DFSPhase::BINARY_LINKS, 0);
+
+  while (!dfs_stack_.empty()) {
+    DFSFrame &f = dfs_stack_.back();
+    unsigned next = 0;
+    LinkIterator next_pos;
+    DFSPhase next_phase = DFSPhase::BINARY_LINKS;
+    unsigned next_remaining = 0;
+    bool finished = false;
+
+    // advance f to its next neighbour in the component
+    switch (f.phase) {
+    case DFSPhase::BINARY_LINKS:
+      if (f.pos->get<VariableIndex>() == varsSENTINEL) {
+        f.phase = DFSPhase::TERNARY_CLAUSES;
+        f.pos++;
+      } else {
+        VariableIndex u = (f.pos++)->get<VariableIndex>();
+        if (isMember(static_cast<unsigned>(u))) {
+          next = static_cast<unsigned>(u);
+          next_pos = beginOfLinkList(u);
+        }
+      }
+      break;
+    case DFSPhase::TERNARY_CLAUSES:
+      if (static_cast<unsigned>(*f.pos) == 0) {
+        f.phase = DFSPhase::LONG_CLAUSES;
+        f.pos++;
+      } else {
+        ClauseIndex cl = f.pos->get<ClauseIndex>();
+        if (isMember(clause_node_ofs + static_cast<unsigned>(cl))) {
+          next = clause_node_ofs + static_cast<unsigned>(cl);
+          next_pos = f.pos + 1;
+          next_phase = DFSPhase::CLAUSE_LITERALS;
+          next_remaining = 2;
+        }
+        f.pos += 3;
+      }
+      break;
+    case DFSPhase::LONG_CLAUSES:
+      if (f.pos->get<ClauseIndex>() == clsSENTINEL) {
+        finished = true;
+      } else {
+        ClauseIndex cl = f.pos->get<ClauseIndex>();
+        if (isMember(clause_node_ofs + static_cast<unsigned>(cl))) {
+          next = clause_node_ofs + static_cast<unsigned>(cl);
+          next_pos = f.pos + 1 + static_cast<unsigned>((f.pos + 1)->get<ClauseIndex>());
+          next_phase = DFSPhase::CLAUSE_LITERALS;
+          next_remaining = ~0u;
+        }
+        f.pos += 2;
+      }
+      break;
+    case DFSPhase::CLAUSE_LITERALS:
+      // the literals stored with a clause omit the variable
+      // it was reached from, which is the parent of the clause node
+      if (f.remaining == 0 || static_cast<unsigned>(*f.pos) == 0) {
+        finished = true;
+      } else {
+        VariableIndex u = (f.pos++)->get<LiteralID>().var();
+        f.remaining--;
+        if (isMember(static_cast<unsigned>(u))) {
+          next = static_cast<unsigned>(u);
+          next_pos = beginOfLinkList(u);
+        }
+      }
+      break;
+    }
+
+    if (finished) {
+      unsigned node = f.node;
+      dfs_stack_.pop_back();
+      if (dfs_stack_.empty())
+        break;
+      unsigned parent = dfs_stack_.back().node;
+      dfs_low_[parent] = std::min(dfs_low_[parent], dfs_low_[node]);
+      if (parent == root)
+        root_children++;
+      else if (parent <= clause_node_ofs && dfs_low_[node] >= dfs_index_[parent])
+        articulation_points_[VariableIndex(parent)] = true;
+    } else if (next != 0) {
+      if (dfs_index_[next] > start)
+        dfs_low_[f.node] = std::min(dfs_low_[f.node], dfs_index_[next]);
+      else
+        visit(next, next_pos, next_phase, next_remaining);
+    }
+  }
+
+  articulation_points_[var] = root_children > 1;
+}
+
 } // sharpSAT namespace
@@ -64,22 +64,24 @@ using namespace std;
 
 namespace sharpSAT {
 
-ComponentCache::ComponentCache(DataAndStatistics &statistics) :
+template<class T_Cacheable>
+GenericComponentCache<T_Cacheable>::GenericComponentCache(DataAndStatistics &statistics) :
 		statistics_(statistics) {
 }
 
-void ComponentCache::init(Component &super_comp, SolverConfiguration &config) {
+template<class T_Cacheable>
+void GenericComponentCache<T_Cacheable>::init(Component &super_comp, SolverConfiguration &config) {
 
 	if (config.verbose) {
-    	cout << sizeof(CacheableComponent) << " " << sizeof(mpz_class) << endl;
+    	cout << sizeof(T_Cacheable) << " " << sizeof(mpz_class) << endl;
 	}
 
-    CacheableComponent &packed_super_comp = *new CacheableComponent(super_comp);
+    T_Cacheable &packed_super_comp = *new T_Cacheable(super_comp);
 	my_time_ = 1;
 
 	entry_base_.clear();
 	entry_base_.reserve(2000000);
-	entry_base_.push_back(new CacheableComponent()); // dummy Element
+	entry_base_.push_back(new T_Cacheable()); // dummy Element
 	table_.clear();
 	table_.resize(1024*1024, 0);
 	table_size_mask_ = table_.size() - 1;
@@ -87,6 +89,10 @@ void ComponentCache::init(Component &super_comp, SolverConfiguration &config) {
 	free_entry_base_slots_.clear();
 	free_entry_base_slots_.reserve(10000);
 
+	branch_hit_sizes_.clear();
+	branch_hit_sizes_.resize(super_comp.num_variables() + 1, 0);
+	max_branch_hit_size_ = 0;
+
 	uint64_t free_ram = freeram();
 	uint64_t max_cache_bound = 95 * (free_ram / 100);
 
@@ -119,7 +125,8 @@ void ComponentCache::init(Component &super_comp, SolverConfiguration &config) {
 	super_comp.set_id(1);
 }
 
-void ComponentCache::test_descendantstree_consistency() {
+template<class T_Cacheable>
+void GenericComponentCache<T_Cacheable>::test_descendantstree_consistency() {
 	for (unsigned id = 2; id < entry_base_.size(); id++)
 		if (entry_base_[id] != nullptr) {
 			CacheEntryID act_child = entry(id).first_descendant();
@@ -148,7 +155,8 @@ void ComponentCache::test_descendantstree_consistency() {
 
 
 
-bool ComponentCache::deleteEntries() {
+template<class T_Cacheable>
+bool GenericComponentCache<T_Cacheable>::deleteEntries() {
   assert(statistics_.cache_full());
 
 	vector<double> scores;
@@ -207,18 +215,21 @@ bool ComponentCache::deleteEntries() {
 }
 
 
-uint64_t ComponentCache::compute_byte_size_infrasture() {
+template<class T_Cacheable>
+uint64_t GenericComponentCache<T_Cacheable>::compute_byte_size_infrasture() {
   statistics_.cache_infrastructure_bytes_memory_usage_ =
-      sizeof(ComponentCache)
+      sizeof(GenericComponentCache<T_Cacheable>)
       + sizeof(CacheEntryID)* table_.capacity()
-      + sizeof(CacheableComponent *)* entry_base_.capacity()
-      + sizeof(CacheEntryID) * free_entry_base_slots_.capacity();
+      + sizeof(T_Cacheable *)* entry_base_.capacity()
+      + sizeof(CacheEntryID) * free_entry_base_slots_.capacity()
+      + sizeof(uint64_t) * branch_hit_sizes_.capacity();
   return statistics_.cache_infrastructure_bytes_memory_usage_;
 }
 
-void ComponentCache::debug_dump_data(){
+template<class T_Cacheable>
+void GenericComponentCache<T_Cacheable>::debug_dump_data(){
     cout << "sizeof (CacheableComponent *, CacheEntryID) "
-         << sizeof(CacheableComponent *) << ", "
+         << sizeof(T_Cacheable *) << ", "
          << sizeof(CacheEntryID) << endl;
     cout << "table (size/capacity) " << table_.size()
          << "/" << table_.capacity() << endl;
@@ -236,4 +247,7 @@ void ComponentCache::debug_dump_data(){
               }
     cout << "model counts size " << alloc_model_counts << endl;
 }
+
+template class GenericComponentCache<CacheableComponent>;
+template class GenericComponentCache<SimpleCacheableComponent>;
 } // sharpSAT namespace
@@ -6,17 +6,22 @@
  */
 
 #include <sharpSAT/component_management.h>
+#include <sharpSAT/component_analyzer.h>
+#include <sharpSAT/new_component_analyzer.h>
+#include <sharpSAT/uf_component_analyzer.h>
 
 using namespace std;
 
 namespace sharpSAT {
 
-void ComponentManager::initialize(LiteralIndexedVector<Literal> & literals,
+template<class T_Analyzer, class T_Cacheable>
+void GenericComponentManager<T_Analyzer, T_Cacheable>::initialize(LiteralIndexedVector<Literal> & literals,
     vector<LiteralID> &lit_pool) {
 
+  ana_.set_incremental_analysis(config_.perform_incremental_analysis);
   ana_.initialize(literals, lit_pool);
   // BEGIN CACHE INIT
-  CacheableComponent::adjustPackSize(ana_.max_variable_id(), ana_.max_clause_id());
+  T_Cacheable::adjustPackSize(ana_.max_variable_id(), ana_.max_clause_id());
 
   component_stack_.clear();
   component_stack_.reserve(static_cast<unsigned>(ana_.max_variable_id()) + 2);
@@ -31,7 +36,8 @@ void ComponentManager::initialize(LiteralIndexedVector<Literal> & literals,
 }
 
 
-void ComponentManager::removeAllCachePollutionsOf(StackLevel &top) {
+template<class T_Analyzer, class T_Cacheable>
+void GenericComponentManager<T_Analyzer, T_Cacheable>::removeAllCachePollutionsOf(StackLevel &top) {
   // all processed components are found in
   // [top.currentRemainingComponent(), component_stack_.size())
   // first, remove the list of descendants from the father
@@ -52,4 +58,13 @@ void ComponentManager::removeAllCachePollutionsOf(StackLevel &top) {
   cache_.test_descendantstree_consistency();
 #endif
 }
+
+template class GenericComponentManager<AltComponentAnalyzer, CacheableComponent>;
+template class GenericComponentManager<AltComponentAnalyzer, SimpleCacheableComponent>;
+template class GenericComponentManager<STDComponentAnalyzer, CacheableComponent>;
+template class GenericComponentManager<STDComponentAnalyzer, SimpleCacheableComponent>;
+template class GenericComponentManager<NewComponentAnalyzer, CacheableComponent>;
+template class GenericComponentManager<NewComponentAnalyzer, SimpleCacheableComponent>;
+template class GenericComponentManager<UFComponentAnalyzer, CacheableComponent>;
+template class GenericComponentManager<UFComponentAnalyzer, SimpleCacheableComponent>;
 } // sharpSAT namespace
@@ -0,0 +1,243 @@
+/*
+ * hypergraph_partitioner.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <sharpSAT/hypergraph_partitioner.h>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+using namespace std;
+
+namespace sharpSAT {
+
+namespace {
+  // coarsening stops at this many vertices
+  const unsigned COARSEST_SIZE = 64;
+  // or once a matching shrinks the graph by less than 10%
+  const double MIN_COARSENING_RATIO = 0.9;
+  // the heavier part may weigh this fraction of the total at most
+  const double MAX_PART_WEIGHT = 0.55;
+  const unsigned NUM_INITIAL_TRIES = 4;
+  const unsigned NUM_REFINEMENT_PASSES = 4;
+  const unsigned NONE = ~0u;
+}
+
+void HypergraphPartitioner::bisect(unsigned num_vertices,
+    const vector<vector<unsigned>> &hyperedges,
+    vector<unsigned char> &side) {
+  side.assign(num_vertices, 0);
+  if (num_vertices < 2)
+    return;
+
+  // the clique expansion, neighbours are merged per vertex below
+  vector<vector<pair<unsigned, float>>> neighbours(num_vertices);
+  for (auto &edge : hyperedges) {
+    if (edge.size() < 2 || edge.size() > MAX_EXPANDED_EDGE_SIZE)
+      continue;
+    float weight = 1.0f / (edge.size() - 1);
+    for (auto u : edge)
+      for (auto v : edge)
+        if (u != v)
+          neighbours[u].push_back(make_pair(v, weight));
+  }
+
+  Graph finest;
+  finest.vertex_weights.assign(num_vertices, 1);
+  finest.adjacency_ofs.push_back(0);
+  for (auto &list : neighbours) {
+    sort(list.begin(), list.end());
+    for (unsigned i = 0; i < list.size(); i++) {
+      if (i > 0 && list[i].first == list[i - 1].first)
+        finest.edge_weights.back() += list[i].second;
+      else {
+        finest.adjacency.push_back(list[i].first);
+        finest.edge_weights.push_back(list[i].second);
+      }
+    }
+    finest.adjacency_ofs.push_back(finest.adjacency.size());
+    vector<pair<unsigned, float>>().swap(list);
+  }
+
+  random_engine_.seed(num_vertices);
+
+  vector<Graph> levels;
+  vector<vector<unsigned>> coarse_of;
+  levels.push_back(move(finest));
+  while (levels.back().size() > COARSEST_SIZE) {
+    vector<unsigned> map;
+    Graph coarse = coarsen(levels.back(), map);
+    if (coarse.size() > MIN_COARSENING_RATIO * levels.back().size())
+      break;
+    coarse_of.push_back(move(map));
+    levels.push_back(move(coarse));
+  }
+
+  vector<unsigned char> coarse_side;
+  initialBisection(levels.back(), coarse_side);
+  refine(levels.back(), coarse_side);
+  for (unsigned l = levels.size() - 1; l > 0; l--) {
+    vector<unsigned char> finer_side(levels[l - 1].size());
+    for (unsigned v = 0; v < finer_side.size(); v++)
+      finer_side[v] = coarse_side[coarse_of[l - 1][v]];
+    coarse_side.swap(finer_side);
+    refine(levels[l - 1], coarse_side);
+  }
+  side.swap(coarse_side);
+}
+
+HypergraphPartitioner::Graph HypergraphPartitioner::coarsen(const Graph &g,
+    vector<unsigned> &coarse_of) {
+  unsigned total_weight = accumulate(g.vertex_weights.begin(),
+                                     g.vertex_weights.end(), 0u);
+  // keeps single coarse vertices from unbalancing the bisection
+  unsigned max_vertex_weight = max(1u, total_weight / 20);
+
+  vector<unsigned> order(g.size());
+  iota(order.begin(), order.end(), 0);
+  shuffle(order.begin(), order.end(), random_engine_);
+
+  vector<unsigned> match(g.size(), NONE);
+  for (auto v : order) {
+    if (match[v] != NONE)
+      continue;
+    unsigned best = v;
+    float best_weight = 0;
+    for (unsigned i = g.adjacency_ofs[v]; i < g.adjacency_ofs[v + 1]; i++) {
+      unsigned u = g.adjacency[i];
+      if (match[u] == NONE && g.edge_weights[i] > best_weight
+          && g.vertex_weights[u] + g.vertex_weights[v] <= max_vertex_weight) {
+        best = u;
+        best_weight = g.edge_weights[i];
+      }
+    }
+    match[v] = best;
+    match[best] = v;
+  }
+
+  Graph coarse;
+  coarse_of.assign(g.size(), NONE);
+  for (unsigned v = 0; v < g.size(); v++)
+    if (coarse_of[v] == NONE) {
+      coarse_of[v] = coarse_of[match[v]] = coarse.vertex_weights.size();
+      coarse.vertex_weights.push_back(g.vertex_weights[v]
+          + (match[v] != v ? g.vertex_weights[match[v]] : 0));
+    }
+
+  // merges the neighbourhoods of each matched pair
+  vector<float> accumulated(coarse.size(), 0);
+  vector<unsigned> touched;
+  coarse.adjacency_ofs.push_back(0);
+  for (unsigned v = 0; v < g.size(); v++) {
+    if (coarse_of[v] != coarse.adjacency_ofs.size() - 1)
+      continue;
+    for (unsigned w : {v, match[v]}) {
+      for (unsigned i = g.adjacency_ofs[w]; i < g.adjacency_ofs[w + 1]; i++) {
+        unsigned cu = coarse_of[g.adjacency[i]];
+        if (cu == coarse_of[v])
+          continue;
+        if (accumulated[cu] == 0)
+          touched.push_back(cu);
+        accumulated[cu] += g.edge_weights[i];
+      }
+      if (match[v] == v)
+        break;
+    }
+    for (auto cu : touched) {
+      coarse.adjacency.push_back(cu);
+      coarse.edge_weights.push_back(accumulated[cu]);
+      accumulated[cu] = 0;
+    }
+    touched.clear();
+    coarse.adjacency_ofs.push_back(coarse.adjacency.size());
+  }
+  return coarse;
+}
+
+void HypergraphPartitioner::initialBisection(const Graph &g,
+    vector<unsigned char> &side) {
+  unsigned total_weight = accumulate(g.vertex_weights.begin(),
+                                     g.vertex_weights.end(), 0u);
+  float best_cut = -1;
+  vector<unsigned char> grown;
+  vector<float> gain;
+  uniform_int_distribution<unsigned> random_vertex(0, g.size() - 1);
+
+  // part 0 is grown from a random vertex, always taking the vertex
+  // of part 1 whose move decreases the cut most
+  for (unsigned t = 0; t < NUM_INITIAL_TRIES; t++) {
+    grown.assign(g.size(), 1);
+    gain.assign(g.size(), 0);
+    unsigned weight = 0;
+    unsigned next = random_vertex(random_engine_);
+    while (weight < total_weight / 2 && next != NONE) {
+      grown[next] = 0;
+      weight += g.vertex_weights[next];
+      for (unsigned i = g.adjacency_ofs[next]; i < g.adjacency_ofs[next + 1]; i++)
+        gain[g.adjacency[i]] += 2 * g.edge_weights[i];
+      next = NONE;
+      for (unsigned v = 0; v < g.size(); v++)
+        if (grown[v] && (next == NONE || gain[v] > gain[next]))
+          next = v;
+    }
+
+    float cut = 0;
+    for (unsigned v = 0; v < g.size(); v++)
+      for (unsigned i = g.adjacency_ofs[v]; i < g.adjacency_ofs[v + 1]; i++)
+        if (grown[v] != grown[g.adjacency[i]])
+          cut += g.edge_weights[i];
+    if (best_cut < 0 || cut < best_cut) {
+      best_cut = cut;
+      side = grown;
+    }
+  }
+}
+
+void HypergraphPartitioner::refine(const Graph &g, vector<unsigned char> &side) {
+  unsigned part_weight[2] = {0, 0};
+  for (unsigned v = 0; v < g.size(); v++)
+    part_weight[side[v]] += g.vertex_weights[v];
+  unsigned max_weight = MAX_PART_WEIGHT * (part_weight[0] + part_weight[1]) + 1;
+
+  // gain of moving v to the other part
+  auto gainOf = [&](unsigned v) {
+    float gain = 0;
+    for (unsigned i = g.adjacency_ofs[v]; i < g.adjacency_ofs[v + 1]; i++)
+      gain += (side[g.adjacency[i]] != side[v] ? 1 : -1) * g.edge_weights[i];
+    return gain;
+  };
+
+  vector<pair<float, unsigned>> candidates;
+  for (unsigned pass = 0; pass < NUM_REFINEMENT_PASSES; pass++) {
+    bool overweight = part_weight[0] > max_weight || part_weight[1] > max_weight;
+    candidates.clear();
+    for (unsigned v = 0; v < g.size(); v++) {
+      float gain = gainOf(v);
+      // while unbalanced, any vertex of the heavier part may move
+      if (gain > 0 || (overweight && part_weight[side[v]] > max_weight))
+        candidates.push_back(make_pair(-gain, v));
+    }
+    sort(candidates.begin(), candidates.end());
+
+    unsigned num_moves = 0;
+    for (auto &candidate : candidates) {
+      unsigned v = candidate.second;
+      unsigned from = side[v], to = 1 - side[v];
+      bool rebalancing = part_weight[from] > max_weight;
+      if (part_weight[to] + g.vertex_weights[v] > max_weight
+          || (!rebalancing && gainOf(v) <= 0))
+        continue;
+      side[v] = to;
+      part_weight[from] -= g.vertex_weights[v];
+      part_weight[to] += g.vertex_weights[v];
+      num_moves++;
+    }
+    if (num_moves == 0)
+      break;
+  }
+}
+
+} // sharpSAT namespace
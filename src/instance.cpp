@@ -131,12 +131,26 @@ void Instance::compactVariables() {
       var_map[v] = last_ofs;
     }
 
+  VariableIndexedVector<VariableIndex> _tmp_original_var_ids = original_var_ids_;
+  original_var_ids_.clear();
+  original_var_ids_.resize(static_cast<unsigned>(last_ofs) + 1, VariableIndex(0));
+  for (VariableIndex v(1); v < VariableIndex(_tmp_original_var_ids.size()); ++v)
+    if (var_map[v] != VariableIndex(0))
+      original_var_ids_[var_map[v]] = _tmp_original_var_ids[v];
+    else if (!isActive(LiteralID(v, true))) {
+      LiteralID orig_lit(_tmp_original_var_ids[v], true);
+      original_literal_values_[orig_lit] = literal_values_[LiteralID(v, true)];
+      original_literal_values_[orig_lit.neg()] = literal_values_[LiteralID(v, false)];
+    }
+
   variables_.clear();
   variables_.resize(static_cast<unsigned>(last_ofs) + 1);
   occurrence_lists_.clear();
   occurrence_lists_.resize(variables_.size());
   literals_.clear();
   literals_.resize(variables_.size());
+  activity_scores_.clear();
+  activity_scores_.resize(variables_.size(), 0.0f);
   viewed_lits_.clear();
   viewed_lits_.resize(variables_.size(),0);
   literal_values_.clear();
@@ -307,9 +321,18 @@ void Instance::initialize(
 
   literals_.clear();
   literals_.resize(nVars + 1);
+  activity_scores_.clear();
+  activity_scores_.resize(nVars + 1, 0.0f);
+  activity_inc_ = clause_score_inc_ = 1.0f;
 
   viewed_lits_.clear();
   viewed_lits_.resize(nVars + 1,0);
+
+  original_var_ids_.clear();
+  for (VariableIndex v(0); v <= VariableIndex(nVars); ++v)
+    original_var_ids_.push_back(v);
+  original_literal_values_.clear();
+  original_literal_values_.resize(nVars + 1, TriValue::X_TRI);
 }
 
 
@@ -7,10 +7,53 @@
 using namespace std;
 using namespace sharpSAT;
 
+// runs the instantiation of GenericSolver for T_Policies,
+// all of them are listed at the end of solver.cpp
+template<class T_Policies>
+void solveWith(const SolverConfiguration &config,
+               uint64_t maximum_cache_size_bytes, const string &input_file) {
+  GenericSolver<T_Policies> theSolver;
+  theSolver.config() = config;
+  theSolver.setTimeBound(config.time_bound_seconds);
+  theSolver.statistics().maximum_cache_size_bytes_ = maximum_cache_size_bytes;
+  theSolver.load_and_solve(input_file);
+}
+
+template<class T_Branching, class T_Analyzer>
+void solveWith(const string &packing, const SolverConfiguration &config,
+               uint64_t maximum_cache_size_bytes, const string &input_file) {
+  if (packing == "simple")
+    solveWith<SolverPolicies<T_Branching, T_Analyzer, SimpleCacheableComponent>>(
+        config, maximum_cache_size_bytes, input_file);
+  else
+    solveWith<SolverPolicies<T_Branching, T_Analyzer, CacheableComponent>>(
+        config, maximum_cache_size_bytes, input_file);
+}
+
+template<class T_Branching>
+void solveWith(const string &analyzer, const string &packing,
+               const SolverConfiguration &config,
+               uint64_t maximum_cache_size_bytes, const string &input_file) {
+  if (analyzer == "std")
+    solveWith<T_Branching, STDComponentAnalyzer>(packing, config,
+        maximum_cache_size_bytes, input_file);
+  else if (analyzer == "new")
+    solveWith<T_Branching, NewComponentAnalyzer>(packing, config,
+        maximum_cache_size_bytes, input_file);
+  else if (analyzer == "uf")
+    solveWith<T_Branching, UFComponentAnalyzer>(packing, config,
+        maximum_cache_size_bytes, input_file);
+  else
+    solveWith<T_Branching, AltComponentAnalyzer>(packing, config,
+        maximum_cache_size_bytes, input_file);
+}
+
 int main(int argc, char *argv[]) {
 
   string input_file;
-  Solver theSolver;
+  SolverConfiguration config;
+  uint64_t maximum_cache_size_bytes = 0;
+  string branching = "vsads", analyzer = "alt", packing = "difference";
 
 
   if (argc <= 1) {
@@ -23,6 +66,29 @@ int main(int argc, char *argv[]) {
     cout << "\t -noCC  \t turn off component caching" << endl;
     cout << "\t -cs [n]\t set max cache size to n MB" << endl;
     cout << "\t -noIBCP\t turn off implicit BCP" << endl;
+    cout << "\t -ncb   \t turn on non-chronological backtracking" << endl;
+    cout << "\t -inc   \t turn on incremental component analysis" << endl;
+    cout << "\t -pol [p]\t set decision polarity to p, one of" << endl;
+    cout << "\t         \t activity (default), saved, negative, cachehits" << endl;
+    cout << "\t -td [w]\t weight of the tree decomposition in branching" << endl;
+    cout << "\t         \t (default 0 = off, try 10)" << endl;
+    cout << "\t -ap [w]\t add w to the branching score of articulation points" << endl;
+    cout << "\t         \t (default 0 = off)" << endl;
+    cout << "\t -chw [w]\t weight of the cache hits on the components found" << endl;
+    cout << "\t         \t in the branches of a variable (default 0 = off)" << endl;
+    cout << "\t -cut [n]\t branch on hypergraph cut sets of components" << endl;
+    cout << "\t         \t with at least n variables (default 0 = off)" << endl;
+    cout << "\t -rs [p]\t set restart policy to p, one of" << endl;
+    cout << "\t         \t none (default), luby, cachemisses" << endl;
+    cout << "\t -rsu [n]\t restart after n * luby(i) conflicts / cache misses" << endl;
+    cout << "\t -br [p]\t set branching policy to p, one of" << endl;
+    cout << "\t         \t vsads (default), occurrences" << endl;
+    cout << "\t -ana [a]\t set component analyzer to a, one of" << endl;
+    cout << "\t         \t alt (default), std, new, uf (-ap, -inc need alt or uf)" << endl;
+    cout << "\t -pack [p]\t set packing of cached components to p, one of" << endl;
+    cout << "\t         \t difference (default), simple" << endl;
+    cout << "\t -lcin [f]\t read learned clauses from file f" << endl;
+    cout << "\t -lcout [f]\t write learned clauses to file f" << endl;
     cout << "\t" << endl;
 
     return -1;
@@ -30,34 +96,144 @@ int main(int argc, char *argv[]) {
 
   for (int i = 1; i < argc; i++) {
     if (strcmp(argv[i], "-noCC") == 0)
-      theSolver.config().perform_component_caching = false;
+      config.perform_component_caching = false;
     if (strcmp(argv[i], "-noIBCP") == 0)
-      theSolver.config().perform_failed_lit_test = false;
+      config.perform_failed_lit_test = false;
+    if (strcmp(argv[i], "-ncb") == 0)
+      config.perform_non_chron_back_track = true;
+    if (strcmp(argv[i], "-inc") == 0)
+      config.perform_incremental_analysis = true;
     if (strcmp(argv[i], "-noPP") == 0)
-      theSolver.config().perform_pre_processing = false;
+      config.perform_pre_processing = false;
     else if (strcmp(argv[i], "-q") == 0)
-      theSolver.config().quiet = true;
+      config.quiet = true;
     else if (strcmp(argv[i], "-v") == 0)
-      theSolver.config().verbose = true;
+      config.verbose = true;
     else if (strcmp(argv[i], "-t") == 0) {
       if (argc <= i + 1) {
         cout << " wrong parameters" << endl;
         return -1;
       }
-      theSolver.setTimeBound(atol(argv[i + 1]));
-      if (theSolver.config().verbose)
-        cout << "time bound set to " << theSolver.config().time_bound_seconds << "s\n";
+      config.time_bound_seconds = atol(argv[i + 1]);
+      if (config.verbose)
+        cout << "time bound set to " << config.time_bound_seconds << "s\n";
      } else if (strcmp(argv[i], "-cs") == 0) {
       if (argc <= i + 1) {
         cout << " wrong parameters" << endl;
         return -1;
       }
-      theSolver.statistics().maximum_cache_size_bytes_ = atol(argv[i + 1]) * (uint64_t) 1000000;
+      maximum_cache_size_bytes = atol(argv[i + 1]) * (uint64_t) 1000000;
+    } else if (strcmp(argv[i], "-pol") == 0) {
+      if (argc <= i + 1) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      i++;
+      if (strcmp(argv[i], "activity") == 0)
+        config.polarity_policy = PolarityPolicy::ACTIVITY;
+      else if (strcmp(argv[i], "saved") == 0)
+        config.polarity_policy = PolarityPolicy::SAVED_PHASE;
+      else if (strcmp(argv[i], "negative") == 0)
+        config.polarity_policy = PolarityPolicy::NEGATIVE;
+      else if (strcmp(argv[i], "cachehits") == 0)
+        config.polarity_policy = PolarityPolicy::CACHE_HITS;
+      else {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+    } else if (strcmp(argv[i], "-td") == 0) {
+      if (argc <= i + 1) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      config.td_weight = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-ap") == 0) {
+      if (argc <= i + 1) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      config.articulation_point_weight = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-chw") == 0) {
+      if (argc <= i + 1) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      config.cache_hit_weight = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-cut") == 0) {
+      if (argc <= i + 1) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      config.cutset_min_component_size = atol(argv[++i]);
+    } else if (strcmp(argv[i], "-rs") == 0) {
+      if (argc <= i + 1) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      i++;
+      if (strcmp(argv[i], "none") == 0)
+        config.restart_policy = RestartPolicy::NONE;
+      else if (strcmp(argv[i], "luby") == 0)
+        config.restart_policy = RestartPolicy::LUBY;
+      else if (strcmp(argv[i], "cachemisses") == 0)
+        config.restart_policy = RestartPolicy::CACHE_MISSES;
+      else {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+    } else if (strcmp(argv[i], "-rsu") == 0) {
+      if (argc <= i + 1) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      config.restart_unit = atol(argv[++i]);
+    } else if (strcmp(argv[i], "-br") == 0) {
+      if (argc <= i + 1
+          || (strcmp(argv[i + 1], "vsads") != 0
+              && strcmp(argv[i + 1], "occurrences") != 0)) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      branching = argv[++i];
+    } else if (strcmp(argv[i], "-ana") == 0) {
+      if (argc <= i + 1
+          || (strcmp(argv[i + 1], "alt") != 0 && strcmp(argv[i + 1], "std") != 0
+              && strcmp(argv[i + 1], "new") != 0
+              && strcmp(argv[i + 1], "uf") != 0)) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      analyzer = argv[++i];
+    } else if (strcmp(argv[i], "-pack") == 0) {
+      if (argc <= i + 1
+          || (strcmp(argv[i + 1], "difference") != 0
+              && strcmp(argv[i + 1], "simple") != 0)) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      packing = argv[++i];
+    } else if (strcmp(argv[i], "-lcin") == 0) {
+      if (argc <= i + 1) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      config.learned_clauses_in_file = argv[++i];
+    } else if (strcmp(argv[i], "-lcout") == 0) {
+      if (argc <= i + 1) {
+        cout << " wrong parameters" << endl;
+        return -1;
+      }
+      config.learned_clauses_out_file = argv[++i];
     } else
       input_file = argv[i];
   }
 
-  theSolver.load_and_solve(input_file);
+  if (branching == "occurrences")
+    solveWith<OccurrenceBranching>(analyzer, packing, config,
+        maximum_cache_size_bytes, input_file);
+  else
+    solveWith<VSADSBranching>(analyzer, packing, config,
+        maximum_cache_size_bytes, input_file);
 
 //  cout << sizeof(LiteralID)<<"MALLOC_STATS:" << endl;
 //  malloc_stats();
@@ -145,10 +145,13 @@ void NewComponentAnalyzer::recordComponentOf(const VariableIndex var) {
               search_stack_.pop_back();
             }
             archetype_.setClause_nil(clID);
-            while(itL->get<LiteralID>() != SENTINEL_LIT) {
+            while(static_cast<unsigned>(*itL) != 0) {
               --itL;
-           	  if(isActive(itL->get<LiteralID>()))
-           	    var_frequency_scores_[itL->get<LiteralID>().var()]--;
+              // the entry before the first literal of the clause
+              // is not a LiteralID, hence the raw read
+              LiteralID lit(static_cast<unsigned>(*itL));
+              if(isActive(lit))
+                var_frequency_scores_[lit.var()]--;
             }
             //END accidentally entered a satisfied clause: undo the search process
             break;
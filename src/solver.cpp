@@ -7,6 +7,7 @@
 #include <sharpSAT/solver.h>
 #include <algorithm>
 #include <deque>
+#include <fstream>
 #include <iostream>
 #include <tuple>
 
@@ -14,19 +15,22 @@ using namespace std;
 
 namespace sharpSAT {
 
-void Solver::print(vector<LiteralID> &vec) {
+template<class T_Policies>
+void GenericSolver<T_Policies>::print(vector<LiteralID> &vec) {
 	for (auto l : vec)
 		cout << l.toInt() << " ";
 	cout << endl;
 }
 
-void Solver::print(vector<unsigned> &vec) {
+template<class T_Policies>
+void GenericSolver<T_Policies>::print(vector<unsigned> &vec) {
 	for (auto l : vec)
 		cout << l << " ";
 	cout << endl;
 }
 
-bool Solver::simplePreProcess() {
+template<class T_Policies>
+bool GenericSolver<T_Policies>::simplePreProcess() {
 
 	if (!config_.perform_pre_processing)
 		return true;
@@ -46,7 +50,8 @@ bool Solver::simplePreProcess() {
 	return succeeded;
 }
 
-bool Solver::prepFailedLiteralTest() {
+template<class T_Policies>
+bool GenericSolver<T_Policies>::prepFailedLiteralTest() {
 	unsigned last_size;
 	do {
 		last_size = literal_stack_.size();
@@ -87,14 +92,15 @@ bool Solver::prepFailedLiteralTest() {
 	return true;
 }
 
-void Solver::HardWireAndCompact() {
+template<class T_Policies>
+void GenericSolver<T_Policies>::HardWireAndCompact() {
 	compactClauses();
 	compactVariables();
 	literal_stack_.clear();
 
 	for (auto l = LiteralID(VariableIndex(1), false); l != literals_.end_lit(); l.inc()) {
-		literal(l).activity_score_ = literal(l).binary_links_.size() - 1;
-		literal(l).activity_score_ += occurrence_lists_[l].size();
+		activity(l) = literal(l).binary_links_.size() - 1;
+		activity(l) += occurrence_lists_[l].size();
 	}
 
 	statistics_.num_unit_clauses_ = unit_clauses_.size();
@@ -106,7 +112,8 @@ void Solver::HardWireAndCompact() {
 	original_lit_pool_size_ = literal_pool_.size();
 }
 
-void Solver::solve() {
+template<class T_Policies>
+void GenericSolver<T_Policies>::solve() {
 	initStack(num_variables());
 
 	if (config_.verbose) {
@@ -124,13 +131,34 @@ void Solver::solve() {
 			statistics_.printShortFormulaInfo();
 		}
 
-		last_ccl_deletion_time_ = last_ccl_cleanup_time_ =
-				statistics_.getTime();
-
 		violated_clause.reserve(num_variables());
 
+		saved_phases_.clear();
+		saved_phases_.resize(num_variables() + 1, TriValue::X_TRI);
+		cache_hit_scores_.clear();
+		cache_hit_scores_.resize(num_variables() + 1, 0);
+
+		td_scores_.clear();
+		td_scores_.resize(num_variables() + 1, 0.0f);
+		if (config_.td_weight != 0)
+			computeTreeDecompositionScores();
+
+		cut_sets_.clear();
+		in_cut_set_.clear();
+		in_cut_set_.resize(num_variables() + 1, false);
+		vertex_of_.clear();
+		vertex_of_.resize(num_variables() + 1, 0);
+
 		comp_manager_.initialize(literals_, literal_pool_);
 
+		// imported clauses are added after the component analyzer
+		// has been set up, s.t. they do not glue components together
+		if (!config_.learned_clauses_in_file.empty())
+			importLearnedClauses(config_.learned_clauses_in_file);
+
+		last_ccl_deletion_time_ = last_ccl_cleanup_time_ =
+				statistics_.num_clauses_learned_;
+
 		statistics_.exit_state_ = countSAT();
 
 		statistics_.set_final_solution_count(stack_.top().getTotalModelCount());
@@ -143,9 +171,191 @@ void Solver::solve() {
 			cout << endl << " FOUND UNSAT DURING PREPROCESSING " << endl;
 		}
 	}
+
+	if (!config_.learned_clauses_out_file.empty())
+		exportLearnedClauses(config_.learned_clauses_out_file);
+}
+
+template<class T_Policies>
+void GenericSolver<T_Policies>::importLearnedClauses(const string &file_name) {
+	ifstream input_file(file_name);
+	if (!input_file) {
+		cerr << "Cannot open file: " << file_name << endl;
+		return;
+	}
+
+	// variable of the input file -> current variable
+	vector<VariableIndex> var_map(statistics_.num_original_variables_ + 1);
+	for (VariableIndex v(1); v < VariableIndex(variables_.size()); ++v)
+		var_map[static_cast<unsigned>(original_var_ids_[v])] = v;
+
+	vector<LiteralID> literals;
+	char c;
+	while (input_file >> c) {
+		input_file.unget();
+		if ((c == '-') || isdigit(c)) {
+			literals.clear();
+			// satisfied clauses are skipped silently, clauses that
+			// cannot be expressed over the current variables are rejected
+			bool satisfied = false;
+			bool valid = true;
+			int lit;
+			while ((input_file >> lit) && lit != 0) {
+				unsigned orig_var = abs(lit);
+				if (orig_var >= var_map.size()) {
+					valid = false;
+					continue;
+				}
+				if (original_literal_values_[LiteralID(lit)] == TriValue::T_TRI) {
+					satisfied = true;
+					continue;
+				}
+				if (original_literal_values_[LiteralID(lit)] == TriValue::F_TRI)
+					continue;
+				if (var_map[orig_var] == VariableIndex(0)) {
+					valid = false;
+					continue;
+				}
+				LiteralID new_lit(var_map[orig_var], lit > 0);
+				if (isSatisfied(new_lit)
+						|| find(literals.begin(), literals.end(), new_lit.neg())
+								!= literals.end())
+					satisfied = true;
+				else if (!isResolved(new_lit)
+						&& find(literals.begin(), literals.end(), new_lit)
+								== literals.end())
+					literals.push_back(new_lit);
+			}
+			if (literals.size() == 1 && isUnitClause(literals[0]))
+				satisfied = true;
+			if (!satisfied) {
+				if (valid && !literals.empty() && isImpliedByBCP(literals)) {
+					addUIPConflictClause(literals);
+					statistics_.num_learned_clauses_imported_++;
+				} else
+					statistics_.num_learned_clauses_rejected_++;
+			}
+		}
+		input_file.ignore(numeric_limits<streamsize>::max(), '\n');
+	}
+	if (config_.verbose)
+		cout << "learned clauses (imported/rejected) "
+				<< statistics_.num_learned_clauses_imported_ << "/"
+				<< statistics_.num_learned_clauses_rejected_ << endl;
 }
 
-void Solver::load_and_solve(const string &file_name) {
+template<class T_Policies>
+void GenericSolver<T_Policies>::computeTreeDecompositionScores() {
+	StopWatch td_stopwatch;
+	// the primal graph, in which each clause forms a clique
+	vector<vector<unsigned>> graph(num_variables() + 1);
+	for (auto l = LiteralID(VariableIndex(1), false); l != literals_.end_lit(); l.inc()) {
+		for (auto it = literal(l).binary_links_.begin(); *it != SENTINEL_LIT; it++)
+			graph[unsigned(l.var())].push_back(unsigned(it->var()));
+		for (auto cl_ofs : occurrence_lists_[l]) {
+			if (*beginOf(cl_ofs) != l)
+				continue;
+			// a clause that long exceeds the width bound anyway
+			auto end = beginOf(cl_ofs);
+			while (*end != SENTINEL_LIT)
+				end++;
+			if (end - beginOf(cl_ofs) > config_.td_max_width + 1)
+				return;
+			for (auto it = beginOf(cl_ofs); it != end; it++)
+				for (auto jt = beginOf(cl_ofs); jt != end; jt++)
+					if (it != jt)
+						graph[unsigned(it->var())].push_back(unsigned(jt->var()));
+		}
+	}
+
+	TreeDecomposition td;
+	td.compute(move(graph), config_.td_time_bound_seconds, config_.td_max_width);
+
+	for (VariableIndex v(1); v <= VariableIndex(num_variables()); v++)
+		td_scores_[v] = 1.0f - td.depth(unsigned(v)) / (td.height() + 1.0f);
+
+	if (config_.verbose)
+		cout << "tree decomposition (width/height) " << td.width() << "/"
+				<< td.height() << (td.completed() ? "" : " (incomplete)")
+				<< " in " << td_stopwatch.getElapsedSeconds() << "s" << endl;
+}
+
+template<class T_Policies>
+void GenericSolver<T_Policies>::exportLearnedClauses(const string &file_name) {
+	ofstream out(file_name);
+	if (!out) {
+		cerr << "Cannot write file: " << file_name << endl;
+		return;
+	}
+
+	vector<vector<LiteralID> > clauses;
+	// assignments hard wired by preprocessing and learned units
+	for (auto l = LiteralID(VariableIndex(1), false);
+			l != original_literal_values_.end_lit(); l.inc())
+		if (original_literal_values_[l] == TriValue::T_TRI)
+			clauses.push_back(vector<LiteralID>(1, l));
+	for (auto lit : unit_clauses_)
+		clauses.push_back(vector<LiteralID>(1, originalLiteralOf(lit)));
+
+	// the remaining space is filled with the conflict clauses
+	// of highest score, preferring short clauses on ties
+	vector<ClauseOfs> ranked = conflict_clauses_;
+	stable_sort(ranked.begin(), ranked.end(),
+			[this](ClauseOfs a, ClauseOfs b) {
+				return getHeaderOf(a).score() > getHeaderOf(b).score()
+						|| (getHeaderOf(a).score() == getHeaderOf(b).score()
+								&& getHeaderOf(a).length() < getHeaderOf(b).length());
+			});
+	if (clauses.size() + ranked.size() > config_.max_learned_clauses_out)
+		ranked.resize(config_.max_learned_clauses_out > clauses.size() ?
+				config_.max_learned_clauses_out - clauses.size() : 0);
+	// the selected clauses are written in the order they were learned,
+	// as this way most of them can be verified by BCP on import
+	sort(ranked.begin(), ranked.end());
+	for (auto cl_ofs : ranked) {
+		clauses.push_back(vector<LiteralID>());
+		for (auto it = beginOf(cl_ofs); *it != SENTINEL_LIT; it++)
+			clauses.back().push_back(originalLiteralOf(*it));
+	}
+	if (clauses.size() > config_.max_learned_clauses_out)
+		clauses.resize(config_.max_learned_clauses_out);
+
+	out << "c learned clauses of " << statistics_.input_file_ << endl;
+	out << "p cnf " << statistics_.num_original_variables_ << " "
+			<< clauses.size() << endl;
+	for (auto &clause : clauses) {
+		for (auto lit : clause)
+			out << lit.toInt() << " ";
+		out << "0" << endl;
+	}
+	statistics_.num_learned_clauses_exported_ = clauses.size();
+}
+
+template<class T_Policies>
+bool GenericSolver<T_Policies>::isImpliedByBCP(const vector<LiteralID> &clause) {
+	size_t sz = literal_stack_.size();
+	bool implied = false;
+	for (auto lit : unit_clauses_)
+		setLiteralIfFree(lit);
+	for (auto lit : clause) {
+		if (isSatisfied(lit)) {
+			implied = true;
+			break;
+		}
+		setLiteralIfFree(lit.neg());
+	}
+	if (!implied)
+		implied = !BCP(sz);
+
+	while (literal_stack_.size() > sz) {
+		unSet(literal_stack_.back());
+		literal_stack_.pop_back();
+	}
+	return implied;
+}
+
+template<class T_Policies>
+void GenericSolver<T_Policies>::load_and_solve(const string &file_name) {
 	stopwatch_.start();
 	statistics_.input_file_ = file_name;
 
@@ -170,11 +380,18 @@ void Solver::load_and_solve(const string &file_name) {
 	}
 }
 
-SOLVER_StateT Solver::countSAT() {
+template<class T_Policies>
+SOLVER_StateT GenericSolver<T_Policies>::countSAT() {
 	retStateT state = retStateT::RESOLVED;
 
 	while (true) {
-		while (comp_manager_.findNextRemainingComponentOf(stack_.top())) {
+		while (findNextRemainingComponent()) {
+			// after a restart, the component
+			// left open on level 0 is the next one again
+			if (restartDue()) {
+				restart();
+				continue;
+			}
 			decideLiteral();
 			if (stopwatch_.timeBoundBroken())
 				return SOLVER_StateT::TIMEOUT;
@@ -205,7 +422,8 @@ SOLVER_StateT Solver::countSAT() {
 	return SOLVER_StateT::SUCCESS;
 }
 
-void Solver::decideLiteral() {
+template<class T_Policies>
+void GenericSolver<T_Policies>::decideLiteral() {
 	// establish another decision stack level
 	stack_.push_back(
 			StackLevel(stack_.top().currentRemainingComponent(),
@@ -214,22 +432,25 @@ void Solver::decideLiteral() {
 	float max_score = -1;
 	float score;
 	VariableIndex max_score_var(0);
-	for (auto it =
-			comp_manager_.superComponentOf(stack_.top()).varsBegin();
-			it->get<VariableIndex>() != varsSENTINEL; it++) {
-		score = scoreOf(it->get<VariableIndex>());
-		if (score > max_score) {
-			max_score = score;
-			max_score_var = it->get<VariableIndex>();
+	Component &super_comp = comp_manager_.superComponentOf(stack_.top());
+	if (config_.articulation_point_weight != 0)
+		comp_manager_.recordArticulationPointsOf(super_comp);
+	if (config_.cutset_min_component_size > 0)
+		max_score_var = decideCutVariable(super_comp);
+	if (max_score_var == VariableIndex(0))
+		for (auto it = super_comp.varsBegin();
+				it->get<VariableIndex>() != varsSENTINEL; it++) {
+			score = scoreOf(it->get<VariableIndex>());
+			if (score > max_score) {
+				max_score = score;
+				max_score_var = it->get<VariableIndex>();
+			}
 		}
-	}
 	// this assert should always hold,
 	// if not then there is a bug in the logic of countSAT();
 	assert(max_score_var != VariableIndex(0));
 
-	LiteralID theLit(max_score_var,
-			literal(LiteralID(max_score_var, true)).activity_score_
-					> literal(LiteralID(max_score_var, false)).activity_score_);
+	LiteralID theLit(max_score_var, polarityOf(max_score_var));
 
 	setLiteralIfFree(theLit);
 	statistics_.num_decisions_++;
@@ -242,7 +463,112 @@ void Solver::decideLiteral() {
 			stack_.top().remaining_components_ofs() <= comp_manager_.component_stack_size());
 }
 
-retStateT Solver::backtrack() {
+template<class T_Policies>
+VariableIndex GenericSolver<T_Policies>::decideCutVariable(const Component &comp) {
+	// cut sets of levels that have been popped are stale
+	while (!cut_sets_.empty()
+			&& cut_sets_.back().decision_level >= stack_.get_decision_level()) {
+		for (auto v : cut_sets_.back().vars)
+			in_cut_set_[v] = false;
+		cut_sets_.pop_back();
+	}
+
+	bool bisected = false;
+	while (true) {
+		float max_score = -1;
+		VariableIndex max_score_var(0);
+		for (auto it = comp.varsBegin();
+				it->get<VariableIndex>() != varsSENTINEL; it++)
+			if (in_cut_set_[it->get<VariableIndex>()]) {
+				float score = scoreOf(it->get<VariableIndex>());
+				if (score > max_score) {
+					max_score = score;
+					max_score_var = it->get<VariableIndex>();
+				}
+			}
+		if (max_score_var != VariableIndex(0) || bisected
+				|| comp.num_variables() < config_.cutset_min_component_size)
+			return max_score_var;
+		// after a rejected bisection, the next one waits
+		// until the component has shrunk noticeably
+		if (!cut_sets_.empty() && cut_sets_.back().vars.empty()
+				&& 4 * comp.num_variables() > 3 * cut_sets_.back().component_size)
+			return max_score_var;
+		computeCutSet(comp);
+		bisected = true;
+	}
+}
+
+template<class T_Policies>
+void GenericSolver<T_Policies>::computeCutSet(const Component &comp) {
+	vector<VariableIndex> vars;
+	for (auto it = comp.varsBegin(); it->get<VariableIndex>() != varsSENTINEL;
+			it++) {
+		vertex_of_[it->get<VariableIndex>()] = vars.size();
+		vars.push_back(it->get<VariableIndex>());
+	}
+
+	// the hyperedges are the clauses not yet satisfied, restricted
+	// to their unassigned variables, all of which lie in comp
+	vector<vector<unsigned>> hyperedges;
+	vector<unsigned> edge;
+	for (auto v : vars)
+		for (auto l : {LiteralID(v, false), LiteralID(v, true)}) {
+			for (auto it = literal(l).binary_links_.begin(); *it != SENTINEL_LIT;
+					it++)
+				if (it->var() > v && isActive(*it))
+					hyperedges.push_back( { vertex_of_[v], vertex_of_[it->var()] });
+			for (auto cl_ofs : occurrence_lists_[l]) {
+				// each clause is added for its first unassigned literal
+				edge.clear();
+				for (auto it = beginOf(cl_ofs); *it != SENTINEL_LIT; it++) {
+					if (isSatisfied(*it) || (edge.empty() && isActive(*it) && *it != l)) {
+						edge.clear();
+						break;
+					}
+					if (isActive(*it))
+						edge.push_back(vertex_of_[it->var()]);
+				}
+				if (edge.size() >= 2)
+					hyperedges.push_back(edge);
+			}
+		}
+
+	vector<unsigned char> side;
+	partitioner_.bisect(vars.size(), hyperedges, side);
+
+	// assigning the variables of each cut hyperedge on one side
+	// leaves its clause on the other side only
+	CutSet cut_set { stack_.get_decision_level(), comp.num_variables(), { } };
+	for (auto &e : hyperedges) {
+		unsigned num_right = 0;
+		for (auto u : e)
+			num_right += side[u];
+		if (num_right == 0 || num_right == e.size())
+			continue;
+		unsigned char cut_side = (2 * num_right <= e.size()) ? 1 : 0;
+		for (auto u : e)
+			if (side[u] == cut_side && !in_cut_set_[vars[u]]) {
+				in_cut_set_[vars[u]] = true;
+				cut_set.vars.push_back(vars[u]);
+			}
+	}
+
+	if (cut_set.vars.empty()
+			|| cut_set.vars.size() > config_.cutset_max_fraction * vars.size()) {
+		for (auto v : cut_set.vars)
+			in_cut_set_[v] = false;
+		cut_set.vars.clear();
+		statistics_.num_cut_sets_rejected_++;
+	} else {
+		statistics_.num_cut_sets_++;
+		statistics_.sum_cut_set_sizes_ += cut_set.vars.size();
+	}
+	cut_sets_.push_back(move(cut_set));
+}
+
+template<class T_Policies>
+retStateT GenericSolver<T_Policies>::backtrack() {
 	assert(
 			stack_.top().remaining_components_ofs() <= comp_manager_.component_stack_size());
 	do {
@@ -280,7 +606,8 @@ retStateT Solver::backtrack() {
 	return retStateT::EXIT;
 }
 
-retStateT Solver::resolveConflict() {
+template<class T_Policies>
+retStateT GenericSolver<T_Policies>::resolveConflict() {
 	recordLastUIPCauses();
 
 	if (statistics_.num_clauses_learned_ - last_ccl_deletion_time_
@@ -306,6 +633,17 @@ retStateT Solver::resolveConflict() {
 		cout << " EMPTY CLAUSE FOUND" << endl;
 	// END DEBUG
 
+	// if the conflict clause contains no literal of the current decision
+	// level, it is already violated at the highest level among its
+	// literals: every branch opened above that level is part of
+	// a branch without models, so we jump back directly
+	if (config_.perform_non_chron_back_track) {
+		int target_level = uip_clauses_.back().empty() ?
+				0 : var(uip_clauses_.back().front()).decision_level;
+		if (target_level < stack_.get_decision_level())
+			backJumpTo(target_level);
+	}
+
 	stack_.top().mark_branch_unsat();
 	//BEGIN Backtracking
 	// maybe the other branch had some solutions
@@ -320,31 +658,27 @@ retStateT Solver::resolveConflict() {
 	// this is because we might have checked a literal
 	// during implict BCP which has been a failed literal
 	// due only to assignments made at lower decision levels
-	if (uip_clauses_.back().front() == TOS_decLit().neg()) {
+	// after a back jump, the clause may contain further literals of this
+	// level besides the decision literal, then it does not assert anything
+	bool asserting = uip_clauses_.back().front() == TOS_decLit().neg();
+	for (auto it = uip_clauses_.back().begin() + 1;
+			asserting && it != uip_clauses_.back().end(); it++)
+		if (var(*it).decision_level == stack_.get_decision_level())
+			asserting = false;
+	if (asserting) {
 		assert(TOS_decLit().neg() == uip_clauses_.back()[0]);
 		var(TOS_decLit().neg()).ante = addUIPConflictClause(
 				uip_clauses_.back());
 		ant = var(TOS_decLit()).ante;
 	}
-//	// RRR
-//	else if(var(uip_clauses_.back().front()).decision_level
-//			< stack_.get_decision_level()
-//			&& assertion_level_ <  stack_.get_decision_level()){
-//         stack_.top().set_both_branches_unsat();
-//         return BACKTRACK;
-//	}
-//
-//
-//	// RRR
 	assert(stack_.get_decision_level() > 0);
 	assert(stack_.top().branch_found_unsat());
 
-	// we do not have to remove pollutions here,
+	// without a back jump we do not have to remove pollutions here,
 	// since conflicts only arise directly before
 	// remaining components are stored
-	// hence
-	assert(
-			stack_.top().remaining_components_ofs() == comp_manager_.component_stack_size());
+	// after a jump, the components of the current branch are discarded
+	comp_manager_.removeAllCachePollutionsOf(stack_.top());
 
 	stack_.top().changeBranch();
 	LiteralID lit = TOS_decLit();
@@ -354,7 +688,66 @@ retStateT Solver::resolveConflict() {
 	return retStateT::RESOLVED;
 }
 
-bool Solver::bcp() {
+template<class T_Policies>
+void GenericSolver<T_Policies>::backJumpTo(int level) {
+	assert(level < stack_.get_decision_level());
+	statistics_.num_back_jumps_++;
+	statistics_.num_levels_jumped_ += stack_.get_decision_level() - level;
+	unwindTo(level);
+}
+
+template<class T_Policies>
+void GenericSolver<T_Policies>::unwindTo(int level) {
+	while (stack_.get_decision_level() > level) {
+		comp_manager_.removeAllCachePollutionsOf(stack_.top());
+		reactivateTOS();
+		stack_.pop_back();
+	}
+}
+
+// the Luby sequence 1 1 2 1 1 2 4 1 1 2 ... (i starting at 0)
+static unsigned long luby(unsigned long i) {
+	unsigned long size = 1, seq = 0;
+	while (size < i + 1) {
+		seq++;
+		size = 2 * size + 1;
+	}
+	while (size - 1 != i) {
+		size = (size - 1) >> 1;
+		seq--;
+		i = i % size;
+	}
+	return 1UL << seq;
+}
+
+template<class T_Policies>
+bool GenericSolver<T_Policies>::restartDue() {
+	if (stack_.get_decision_level() == 0)
+		return false;
+	unsigned long limit = config_.restart_unit * luby(statistics_.num_restarts_);
+	switch (config_.restart_policy) {
+	case RestartPolicy::LUBY:
+		return statistics_.num_conflicts_ - last_restart_conflicts_ >= limit;
+	case RestartPolicy::CACHE_MISSES:
+		return statistics_.num_cache_look_ups_ - statistics_.num_cache_hits_
+				- last_restart_cache_misses_ >= limit;
+	case RestartPolicy::NONE:
+		break;
+	}
+	return false;
+}
+
+template<class T_Policies>
+void GenericSolver<T_Policies>::restart() {
+	statistics_.num_restarts_++;
+	last_restart_conflicts_ = statistics_.num_conflicts_;
+	last_restart_cache_misses_ =
+			statistics_.num_cache_look_ups_ - statistics_.num_cache_hits_;
+	unwindTo(0);
+}
+
+template<class T_Policies>
+bool GenericSolver<T_Policies>::bcp() {
 // the asserted literal has been set, so we start
 // bcp on that literal
 	size_t start_ofs = literal_stack_.size() - 1;
@@ -372,7 +765,8 @@ bool Solver::bcp() {
 	return bSucceeded;
 }
 
-bool Solver::BCP(size_t start_at_stack_ofs) {
+template<class T_Policies>
+bool GenericSolver<T_Policies>::BCP(size_t start_at_stack_ofs) {
 	for (size_t i = start_at_stack_ofs; i < literal_stack_.size(); i++) {
 		LiteralID unLit = literal_stack_[i].neg();
 		//BEGIN Propagate Bin Clauses
@@ -491,7 +885,8 @@ bool Solver::BCP(size_t start_at_stack_ofs) {
 //}
 
 // this is IBCP 30.08
-bool Solver::implicitBCP() {
+template<class T_Policies>
+bool GenericSolver<T_Policies>::implicitBCP() {
 	vector<LiteralID> test_lits;
 
 	unsigned stack_ofs = stack_.top().literal_stack_ofs();
@@ -518,7 +913,7 @@ bool Solver::implicitBCP() {
 		vector<float> scores;
 		scores.clear();
 		for (auto jt = test_lits.begin(); jt != test_lits.end(); jt++) {
-			scores.push_back(literal(*jt).activity_score_);
+			scores.push_back(activity(*jt));
 		}
 		sort(scores.begin(), scores.end());
 		num_curr_lits = 10 + num_curr_lits / 20;
@@ -530,7 +925,7 @@ bool Solver::implicitBCP() {
 		statistics_.num_failed_literal_tests_ += test_lits.size();
 
 		for (auto lit : test_lits)
-			if (isActive(lit) && threshold <= literal(lit).activity_score_) {
+			if (isActive(lit) && threshold <= activity(lit)) {
 				unsigned sz = literal_stack_.size();
 				// we increase the decLev artificially
 				// s.t. after the tentative BCP call, we can learn a conflict clause
@@ -584,8 +979,8 @@ bool Solver::implicitBCP() {
 //			}
 //		}
 //	LiteralID theLit(max_score_var,
-//			literal(LiteralID(max_score_var, true)).activity_score_
-//					> literal(LiteralID(max_score_var, false)).activity_score_);
+//			activity(LiteralID(max_score_var, true))
+//					> activity(LiteralID(max_score_var, false)));
 //	if (!fail_test(theLit.neg())) {
 //		cout << ".";
 //
@@ -606,14 +1001,15 @@ bool Solver::implicitBCP() {
 // BEGIN module conflictAnalyzer
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
-void Solver::minimizeAndStoreUIPClause(LiteralID uipLit,
+template<class T_Policies>
+void GenericSolver<T_Policies>::minimizeAndStoreUIPClause(LiteralID uipLit,
 		vector<LiteralID> & tmp_clause,
 		const VariableIndexedVector<bool>& seen) {
 	static deque<LiteralID> clause;
 	clause.clear();
 	assertion_level_ = 0;
 	for (auto lit : tmp_clause) {
-		if (existsUnitClauseOf(lit.var()))
+		if (isUnitClause(lit.neg()))
 			continue;
 		bool resolve_out = false;
 		if (hasAntecedent(lit)) {
@@ -649,11 +1045,15 @@ void Solver::minimizeAndStoreUIPClause(LiteralID uipLit,
 	uip_clauses_.push_back(vector<LiteralID>(clause.begin(), clause.end()));
 }
 
-void Solver::recordLastUIPCauses() {
+template<class T_Policies>
+void GenericSolver<T_Policies>::recordLastUIPCauses() {
 // note:
 // variables of lower dl: if seen we dont work with them anymore
 // variables of this dl: if seen we incorporate their
 // antecedent and set to unseen
+// literals falsified by a learned unit clause are resolved with it,
+// but not those falsified against it: once the decision stack was
+// unwound, the variable of a unit clause may be assigned either way
 
     // ToDo:: This can cause some slowdown because of allocations.
     //        If this proves problematic, we can cache the allocation,
@@ -671,13 +1071,13 @@ void Solver::recordLastUIPCauses() {
 	unsigned lits_at_current_dl = 0;
 
 	for (auto l : violated_clause) {
-		if (var(l).decision_level == 0 || existsUnitClauseOf(l.var()))
+		if (var(l).decision_level == 0 || isUnitClause(l.neg()))
 			continue;
 		if (var(l).decision_level < DL)
 			tmp_clause.push_back(l);
 		else
 			lits_at_current_dl++;
-		literal(l).increaseActivity();
+		increaseActivity(l);
 		seen[l.var()] = true;
 	}
 
@@ -713,7 +1113,7 @@ void Solver::recordLastUIPCauses() {
 			for (auto it = beginOf(getAntecedent(curr_lit).asCl()) + 1;
 					*it != SENTINEL_LIT; it++) {
 				if (seen[it->var()] || (var(*it).decision_level == 0)
-						|| existsUnitClauseOf(it->var()))
+						|| isUnitClause(it->neg()))
 					continue;
 				if (var(*it).decision_level < DL)
 					tmp_clause.push_back(*it);
@@ -723,10 +1123,10 @@ void Solver::recordLastUIPCauses() {
 			}
 		} else {
 			LiteralID alit = getAntecedent(curr_lit).asLit();
-			literal(alit).increaseActivity();
-			literal(curr_lit).increaseActivity();
+			increaseActivity(alit);
+			increaseActivity(curr_lit);
 			if (!seen[alit.var()] && !(var(alit).decision_level == 0)
-					&& !existsUnitClauseOf(alit.var())) {
+					&& !isUnitClause(alit.neg())) {
 				if (var(alit).decision_level < DL)
 					tmp_clause.push_back(alit);
 				else
@@ -746,7 +1146,8 @@ void Solver::recordLastUIPCauses() {
 //		assertion_level_ = var(curr_lit).decision_level;
 }
 
-void Solver::recordAllUIPCauses() {
+template<class T_Policies>
+void GenericSolver<T_Policies>::recordAllUIPCauses() {
 // note:
 // variables of lower dl: if seen we dont work with them anymore
 // variables of this dl: if seen we incorporate their
@@ -767,13 +1168,13 @@ void Solver::recordAllUIPCauses() {
 	unsigned lits_at_current_dl = 0;
 
 	for (auto l : violated_clause) {
-		if (var(l).decision_level == 0 || existsUnitClauseOf(l.var()))
+		if (var(l).decision_level == 0 || isUnitClause(l.neg()))
 			continue;
 		if (var(l).decision_level < DL)
 			tmp_clause.push_back(l);
 		else
 			lits_at_current_dl++;
-		literal(l).increaseActivity();
+		increaseActivity(l);
 		seen[l.var()] = true;
 	}
 	unsigned n = 0;
@@ -808,7 +1209,7 @@ void Solver::recordAllUIPCauses() {
 			for (auto it = beginOf(getAntecedent(curr_lit).asCl()) + 1;
 					*it != SENTINEL_LIT; it++) {
 				if (seen[it->var()] || (var(*it).decision_level == 0)
-						|| existsUnitClauseOf(it->var()))
+						|| isUnitClause(it->neg()))
 					continue;
 				if (var(*it).decision_level < DL)
 					tmp_clause.push_back(*it);
@@ -818,10 +1219,10 @@ void Solver::recordAllUIPCauses() {
 			}
 		} else {
 			LiteralID alit = getAntecedent(curr_lit).asLit();
-			literal(alit).increaseActivity();
-			literal(curr_lit).increaseActivity();
+			increaseActivity(alit);
+			increaseActivity(curr_lit);
 			if (!seen[alit.var()] && !(var(alit).decision_level == 0)
-					&& !existsUnitClauseOf(alit.var())) {
+					&& !isUnitClause(alit.neg())) {
 				if (var(alit).decision_level < DL)
 					tmp_clause.push_back(alit);
 				else
@@ -837,7 +1238,8 @@ void Solver::recordAllUIPCauses() {
 //		assertion_level_ = var(curr_lit).decision_level;
 }
 
-void Solver::printOnlineStats() {
+template<class T_Policies>
+void GenericSolver<T_Policies>::printOnlineStats() {
 	if (config_.quiet)
 		return;
 
@@ -871,4 +1273,20 @@ void Solver::printOnlineStats() {
 	}
 }
 
+template class GenericSolver<DefaultSolverPolicies>;
+template class GenericSolver<SolverPolicies<VSADSBranching, AltComponentAnalyzer, SimpleCacheableComponent>>;
+template class GenericSolver<SolverPolicies<VSADSBranching, STDComponentAnalyzer, CacheableComponent>>;
+template class GenericSolver<SolverPolicies<VSADSBranching, STDComponentAnalyzer, SimpleCacheableComponent>>;
+template class GenericSolver<SolverPolicies<VSADSBranching, NewComponentAnalyzer, CacheableComponent>>;
+template class GenericSolver<SolverPolicies<VSADSBranching, NewComponentAnalyzer, SimpleCacheableComponent>>;
+template class GenericSolver<SolverPolicies<VSADSBranching, UFComponentAnalyzer, CacheableComponent>>;
+template class GenericSolver<SolverPolicies<VSADSBranching, UFComponentAnalyzer, SimpleCacheableComponent>>;
+template class GenericSolver<SolverPolicies<OccurrenceBranching, AltComponentAnalyzer, CacheableComponent>>;
+template class GenericSolver<SolverPolicies<OccurrenceBranching, AltComponentAnalyzer, SimpleCacheableComponent>>;
+template class GenericSolver<SolverPolicies<OccurrenceBranching, STDComponentAnalyzer, CacheableComponent>>;
+template class GenericSolver<SolverPolicies<OccurrenceBranching, STDComponentAnalyzer, SimpleCacheableComponent>>;
+template class GenericSolver<SolverPolicies<OccurrenceBranching, NewComponentAnalyzer, CacheableComponent>>;
+template class GenericSolver<SolverPolicies<OccurrenceBranching, NewComponentAnalyzer, SimpleCacheableComponent>>;
+template class GenericSolver<SolverPolicies<OccurrenceBranching, UFComponentAnalyzer, CacheableComponent>>;
+template class GenericSolver<SolverPolicies<OccurrenceBranching, UFComponentAnalyzer, SimpleCacheableComponent>>;
 } // sharpSAT namespace
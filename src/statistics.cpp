@@ -57,10 +57,23 @@ void DataAndStatistics::printShort() {
       << num_original_clauses_ - num_clauses() << ")" << endl;
   cout << "decisions \t\t\t\t" << num_decisions_ << endl;
   cout << "conflicts \t\t\t\t" << num_conflicts_ << endl;
+  cout << "back jumps (all / levels) \t\t" << num_back_jumps_ << "/"
+      << num_levels_jumped_ << endl;
+  cout << "restarts \t\t\t\t" << num_restarts_ << endl;
+  if (num_cut_sets_ + num_cut_sets_rejected_ > 0)
+    cout << "cut sets (all/rejected/avg size) \t" << num_cut_sets_ << "/"
+        << num_cut_sets_rejected_ << "/"
+        << (num_cut_sets_ ? sum_cut_set_sizes_ / num_cut_sets_ : 0) << endl;
   cout << "conflict clauses (all/bin/unit) \t";
   cout << num_conflict_clauses();
   cout << "/" << num_binary_conflict_clauses_ << "/" << num_unit_clauses_
       << endl << endl;
+  if (num_learned_clauses_imported_ + num_learned_clauses_rejected_
+      + num_learned_clauses_exported_ > 0)
+    cout << "learned clauses (imported/rejected/exported) \t"
+        << num_learned_clauses_imported_ << "/"
+        << num_learned_clauses_rejected_ << "/"
+        << num_learned_clauses_exported_ << endl << endl;
   cout << "failed literals found by implicit BCP \t "
       << num_failed_literals_detected_ << endl;
 
@@ -86,6 +99,9 @@ void DataAndStatistics::printShort() {
   cout << "cache (stores / hits) \t\t\t" << num_cached_components_ << "/"
       << num_cache_hits_ << endl;
   cout << "cache miss rate " << cache_miss_rate() * 100 << "%" << endl;
+  cout << "cache hit rate (look ups / variables) \t"
+      << (1 - cache_miss_rate()) * 100 << "% / "
+      << cache_hit_variable_rate() * 100 << "%" << endl;
   cout << "avg. variable count (stores / hits) \t" << getAvgComponentSize()
       << "/" << getAvgCacheHitSize() << endl << endl;
   cout << "\n# solutions " << endl;
@@ -0,0 +1,214 @@
+/*
+ * tree_decomposition.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <sharpSAT/tree_decomposition.h>
+#include <sharpSAT/stopwatch.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <utility>
+
+using namespace std;
+
+namespace sharpSAT {
+
+const unsigned TreeDecomposition::NO_BAG;
+
+void TreeDecomposition::compute(vector<vector<unsigned>> graph,
+                                double time_bound_seconds,
+                                unsigned max_width) {
+  unsigned num_vertices = graph.size() - 1;
+  for (auto &neighbours : graph) {
+    sort(neighbours.begin(), neighbours.end());
+    neighbours.erase(unique(neighbours.begin(), neighbours.end()),
+                     neighbours.end());
+  }
+
+  bags_.assign(num_vertices + 1, vector<unsigned>());
+  parent_.assign(num_vertices + 1, NO_BAG);
+  position_.assign(num_vertices + 1, NO_BAG);
+  depth_.assign(num_vertices + 1, NO_BAG);
+  width_ = height_ = 0;
+
+  eliminate(graph, time_bound_seconds, max_width);
+
+  // children of each bag, in compressed form
+  children_ofs_.assign(num_vertices + 2, 0);
+  for (unsigned v = 1; v <= num_vertices; v++)
+    if (parent_[v] != NO_BAG)
+      children_ofs_[parent_[v] + 1]++;
+  for (unsigned b = 1; b < children_ofs_.size(); b++)
+    children_ofs_[b] += children_ofs_[b - 1];
+  children_.resize(children_ofs_.back());
+  vector<unsigned> next_child(children_ofs_.begin(), children_ofs_.end() - 1);
+  for (unsigned v = 1; v <= num_vertices; v++)
+    if (parent_[v] != NO_BAG)
+      children_[next_child[parent_[v]]++] = v;
+
+  distance_.assign(num_vertices + 1, NO_BAG);
+  predecessor_.assign(num_vertices + 1, NO_BAG);
+
+  if (!bags_[0].empty())
+    rootAtCenter(0);
+  for (unsigned v = 1; v <= num_vertices; v++)
+    if (position_[v] != NO_BAG && parent_[v] == NO_BAG)
+      rootAtCenter(v);
+
+  for (unsigned v = 1; v <= num_vertices; v++)
+    height_ = max(height_, depth_[v]);
+
+  // only the depths are needed from here on
+  vector<vector<unsigned>>().swap(bags_);
+  vector<unsigned>().swap(children_);
+  vector<unsigned>().swap(distance_);
+  vector<unsigned>().swap(predecessor_);
+  vector<unsigned>().swap(visited_);
+}
+
+void TreeDecomposition::eliminate(vector<vector<unsigned>> &graph,
+                                  double time_bound_seconds,
+                                  unsigned max_width) {
+  StopWatch stopwatch;
+  unsigned num_vertices = graph.size() - 1;
+  unsigned num_eliminated = 0;
+
+  // (degree, vertex), entries become stale when the degree changes
+  typedef pair<unsigned, unsigned> DegreeAndVertex;
+  priority_queue<DegreeAndVertex, vector<DegreeAndVertex>,
+                 greater<DegreeAndVertex>> queue;
+  for (unsigned v = 1; v <= num_vertices; v++)
+    queue.push(DegreeAndVertex(graph[v].size(), v));
+
+  vector<unsigned> merged;
+  while (!queue.empty()) {
+    unsigned degree = queue.top().first;
+    unsigned v = queue.top().second;
+    if (position_[v] != NO_BAG || degree != graph[v].size()) {
+      queue.pop();
+      continue;
+    }
+    if (degree > max_width)
+      break;
+    if ((num_eliminated & 63) == 0
+        && stopwatch.getElapsedSeconds() > time_bound_seconds)
+      break;
+    queue.pop();
+
+    position_[v] = num_eliminated++;
+    width_ = max(width_, degree);
+
+    // the neighbours of v become a clique
+    const vector<unsigned> &clique = graph[v];
+    for (auto u : clique) {
+      merged.clear();
+      const vector<unsigned> &neighbours = graph[u];
+      auto it = neighbours.begin(), jt = clique.begin();
+      while (it != neighbours.end() || jt != clique.end()) {
+        unsigned w;
+        if (jt == clique.end() || (it != neighbours.end() && *it < *jt))
+          w = *(it++);
+        else if (it == neighbours.end() || *jt < *it)
+          w = *(jt++);
+        else {
+          w = *(it++);
+          jt++;
+        }
+        if (w != u && w != v)
+          merged.push_back(w);
+      }
+      graph[u].swap(merged);
+      queue.push(DegreeAndVertex(graph[u].size(), u));
+    }
+    bags_[v].swap(graph[v]);
+  }
+
+  for (unsigned v = 1; v <= num_vertices; v++)
+    if (position_[v] == NO_BAG)
+      bags_[0].push_back(v);
+  completed_ = bags_[0].empty();
+  if (!completed_)
+    width_ = max(width_, (unsigned) bags_[0].size() - 1);
+
+  // the parent of a bag is that of the neighbour eliminated first,
+  // or the extra bag if all neighbours are left over
+  for (unsigned v = 1; v <= num_vertices; v++) {
+    if (position_[v] == NO_BAG || bags_[v].empty())
+      continue;
+    unsigned first = NO_BAG;
+    for (auto u : bags_[v])
+      if (position_[u] != NO_BAG
+          && (first == NO_BAG || position_[u] < position_[first]))
+        first = u;
+    parent_[v] = (first == NO_BAG) ? 0 : first;
+  }
+}
+
+void TreeDecomposition::breadthFirstSearch(unsigned start) {
+  for (auto b : visited_) {
+    distance_[b] = NO_BAG;
+    predecessor_[b] = NO_BAG;
+  }
+  visited_.clear();
+  visited_.push_back(start);
+  distance_[start] = 0;
+  for (unsigned i = 0; i < visited_.size(); i++) {
+    unsigned b = visited_[i];
+    auto visit = [&](unsigned next) {
+      if (distance_[next] == NO_BAG) {
+        distance_[next] = distance_[b] + 1;
+        predecessor_[next] = b;
+        visited_.push_back(next);
+      }
+    };
+    if (parent_[b] != NO_BAG)
+      visit(parent_[b]);
+    for (unsigned c = children_ofs_[b]; c < children_ofs_[b + 1]; c++)
+      visit(children_[c]);
+  }
+}
+
+void TreeDecomposition::rootAtCenter(unsigned root) {
+  // the center lies halfway on a longest path
+  breadthFirstSearch(root);
+  unsigned end_a = visited_.back();
+  breadthFirstSearch(end_a);
+  unsigned center = visited_.back();
+  for (unsigned steps = distance_[center] / 2; steps > 0; steps--)
+    center = predecessor_[center];
+
+  breadthFirstSearch(center);
+
+  // a vertex appears in its own bag and in bags below it, so its
+  // topmost bag is its own, unless the center lies below it: then it is
+  // the first bag containing the vertex on the way up from the center
+  // (position_ is not needed anymore, from here on NO_BAG marks
+  // the vertices whose topmost bag lies on the path, i.e. those of the
+  // path and those left over)
+  vector<unsigned> path;
+  for (unsigned b = center; b != NO_BAG; b = parent_[b])
+    path.push_back(b);
+  for (auto b : path)
+    if (b != 0)
+      position_[b] = NO_BAG;
+
+  for (auto b : visited_)
+    if (b != 0 && position_[b] != NO_BAG)
+      depth_[b] = distance_[b];
+
+  for (auto b : path) {
+    auto assign = [&](unsigned v) {
+      if (position_[v] == NO_BAG && depth_[v] == NO_BAG)
+        depth_[v] = distance_[b];
+    };
+    if (b != 0)
+      assign(b);
+    for (auto v : bags_[b])
+      assign(v);
+  }
+}
+
+} // sharpSAT namespace
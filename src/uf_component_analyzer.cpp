@@ -0,0 +1,172 @@
+/*
+ * uf_component_analyzer.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <sharpSAT/uf_component_analyzer.h>
+
+using namespace std;
+
+namespace sharpSAT {
+
+void UFComponentAnalyzer::initialize(LiteralIndexedVector<Literal> & literals,
+    vector<LiteralID> &lit_pool) {
+  AltComponentAnalyzer::initialize(literals, lit_pool);
+
+  unsigned max_variable_id = static_cast<unsigned>(max_variable_id_);
+  set_parent_.assign(max_variable_id + 1, VariableIndex(0));
+  set_rank_.assign(max_variable_id + 1, 0);
+  comp_of_.assign(max_variable_id + 1, 0);
+  clause_var_.assign(static_cast<unsigned>(max_clause_id_) + 1, VariableIndex(0));
+}
+
+void UFComponentAnalyzer::setupAnalysisContext(StackLevel &top,
+    Component & super_comp) {
+  AltComponentAnalyzer::setupAnalysisContext(top, super_comp);
+
+  for (auto vt = super_comp.varsBegin(); vt->get<VariableIndex>() != varsSENTINEL; vt++)
+    if (archetype_.var_unseen_in_sup_comp(vt->get<VariableIndex>())) {
+      set_parent_[vt->get<VariableIndex>()] = vt->get<VariableIndex>();
+      set_rank_[vt->get<VariableIndex>()] = 0;
+      comp_of_[vt->get<VariableIndex>()] = ~0u;
+    }
+
+  for (auto vt = super_comp.varsBegin(); vt->get<VariableIndex>() != varsSENTINEL; vt++)
+    if (archetype_.var_unseen_in_sup_comp(vt->get<VariableIndex>()))
+      uniteThroughLinksOf(vt->get<VariableIndex>());
+
+  // the components are numbered in the order of their first variables,
+  // the order the AltComponentAnalyzer finds them in; a root takes
+  // the number of its component before it is reached itself
+  unsigned num_comps = 0;
+  comp_var_ofs_.assign(1, 0);
+  for (auto vt = super_comp.varsBegin(); vt->get<VariableIndex>() != varsSENTINEL; vt++) {
+    VariableIndex v = vt->get<VariableIndex>();
+    if (!archetype_.var_unseen_in_sup_comp(v))
+      continue;
+    VariableIndex root = findSet(v);
+    if (comp_of_[root] == ~0u) {
+      comp_of_[root] = num_comps++;
+      comp_var_ofs_.push_back(0);
+    }
+    comp_of_[v] = comp_of_[root];
+    comp_var_ofs_[comp_of_[v] + 1]++;
+  }
+
+  comp_clause_ofs_.assign(num_comps + 1, 0);
+  for (auto itCl = super_comp.clsBegin(); itCl->get<ClauseIndex>() != clsSENTINEL; itCl++)
+    if (archetype_.clause_seen(itCl->get<ClauseIndex>()))
+      comp_clause_ofs_[comp_of_[clause_var_[static_cast<unsigned>(itCl->get<ClauseIndex>())]] + 1]++;
+
+  for (unsigned c = 0; c < num_comps; c++) {
+    comp_var_ofs_[c + 1] += comp_var_ofs_[c];
+    comp_clause_ofs_[c + 1] += comp_clause_ofs_[c];
+  }
+
+  // fill in the components, each one's offset is advanced while
+  // it is filled and moved back after
+  comp_vars_.resize(comp_var_ofs_[num_comps]);
+  comp_clauses_.resize(comp_clause_ofs_[num_comps]);
+  for (auto vt = super_comp.varsBegin(); vt->get<VariableIndex>() != varsSENTINEL; vt++)
+    if (archetype_.var_unseen_in_sup_comp(vt->get<VariableIndex>()))
+      comp_vars_[comp_var_ofs_[comp_of_[vt->get<VariableIndex>()]]++] = vt->get<VariableIndex>();
+  for (auto itCl = super_comp.clsBegin(); itCl->get<ClauseIndex>() != clsSENTINEL; itCl++)
+    if (archetype_.clause_seen(itCl->get<ClauseIndex>())) {
+      unsigned c = comp_of_[clause_var_[static_cast<unsigned>(itCl->get<ClauseIndex>())]];
+      comp_clauses_[comp_clause_ofs_[c]++] = itCl->get<ClauseIndex>();
+    }
+  for (unsigned c = num_comps; c > 0; c--) {
+    comp_var_ofs_[c] = comp_var_ofs_[c - 1];
+    comp_clause_ofs_[c] = comp_clause_ofs_[c - 1];
+  }
+  comp_var_ofs_[0] = comp_clause_ofs_[0] = 0;
+}
+
+void UFComponentAnalyzer::uniteThroughLinksOf(VariableIndex v) {
+  auto p = beginOfLinkList(v);
+  for (; p->get<VariableIndex>() != varsSENTINEL; p++) {
+    VariableIndex u = p->get<VariableIndex>();
+    if (!archetype_.var_unseen_in_sup_comp(u))
+      continue;
+    var_frequency_scores_[v]++;
+    uniteSets(v, u);
+  }
+
+  for (p++; static_cast<unsigned>(*p); p += 3) {
+    ClauseIndex clID = p->get<ClauseIndex>();
+    if (!archetype_.clause_unseen_in_sup_comp(clID))
+      continue;
+    LiteralID litA = (p + 1)->get<LiteralID>();
+    LiteralID litB = (p + 2)->get<LiteralID>();
+    if (isSatisfied(litA) || isSatisfied(litB)) {
+      archetype_.setClause_nil(clID);
+      continue;
+    }
+    var_frequency_scores_[v]++;
+    for (auto lit : {litA, litB})
+      if (isActive(lit)) {
+        var_frequency_scores_[lit.var()]++;
+        uniteSets(v, lit.var());
+      }
+    archetype_.setClause_seen(clID, isActive(litA) & isActive(litB));
+    clause_var_[static_cast<unsigned>(clID)] = v;
+  }
+
+  for (p++; p->get<ClauseIndex>() != clsSENTINEL; p += 2)
+    if (archetype_.clause_unseen_in_sup_comp(p->get<ClauseIndex>()))
+      uniteThroughClause(v, p->get<ClauseIndex>(),
+          p + 1 + static_cast<unsigned>((p + 1)->get<ClauseIndex>()));
+}
+
+void UFComponentAnalyzer::uniteThroughClause(VariableIndex v, ClauseIndex clID,
+    LinkIterator pstart_cls) {
+  // a satisfied clause must not unite anything, so it is checked first
+  bool all_lits_active = true;
+  for (auto itL = pstart_cls; static_cast<unsigned>(*itL) != 0; itL++) {
+    if (isSatisfied(itL->get<LiteralID>())) {
+      archetype_.setClause_nil(clID);
+      return;
+    }
+    all_lits_active &= isActive(itL->get<LiteralID>());
+  }
+
+  for (auto itL = pstart_cls; static_cast<unsigned>(*itL) != 0; itL++)
+    if (isActive(itL->get<LiteralID>())) {
+      var_frequency_scores_[itL->get<LiteralID>().var()]++;
+      uniteSets(v, itL->get<LiteralID>().var());
+    }
+  var_frequency_scores_[v]++;
+  archetype_.setClause_seen(clID, all_lits_active);
+  clause_var_[static_cast<unsigned>(clID)] = v;
+}
+
+Component *UFComponentAnalyzer::makeComponentFromArcheType() {
+  unsigned c = current_comp_;
+  Component &cache_key = archetype_.current_comp_for_caching_;
+  Component *p_new_comp = new Component();
+  p_new_comp->reserveSpace(comp_var_ofs_[c + 1] - comp_var_ofs_[c],
+                           comp_clause_ofs_[c + 1] - comp_clause_ofs_[c]);
+  cache_key.clear();
+  for (unsigned i = comp_var_ofs_[c]; i < comp_var_ofs_[c + 1]; i++) {
+    p_new_comp->addVar(comp_vars_[i]);
+    cache_key.addVar(comp_vars_[i]);
+  }
+  p_new_comp->closeVariableData();
+  cache_key.closeVariableData();
+
+  for (unsigned i = comp_clause_ofs_[c]; i < comp_clause_ofs_[c + 1]; i++) {
+    ClauseIndex cl = comp_clauses_[i];
+    bool has_false_lit = !archetype_.clause_all_lits_active(cl);
+    p_new_comp->addCl(cl);
+    if (has_false_lit)
+      cache_key.addCl(cl);
+    if (incremental_analysis_)
+      clause_has_false_lit_[static_cast<unsigned>(cl)] = has_false_lit;
+  }
+  p_new_comp->closeClauseData();
+  cache_key.closeClauseData();
+  return p_new_comp;
+}
+
+} // sharpSAT namespace